@@ -5,9 +5,51 @@
 #include "Utility.hpp"
 #include "VOLKBlock.hpp"
 
+#include <Pothos/Exception.hpp>
+
 #include <volk/volk.h>
 
+#include <algorithm>
+#include <cmath>
 #include <complex>
+#include <string>
+
+// In the higher precision modes, each buffer is summed by the VOLK
+// kernel in tiles of this size, which keeps the float error of each
+// partial sum small. The partial sums are then added in double.
+static constexpr size_t TileSize = 4096;
+
+template <typename T>
+struct PreciseType { using type = double; };
+
+template <>
+struct PreciseType<std::complex<float>> { using type = std::complex<double>; };
+
+// Neumaier's variant of Kahan summation, which also compensates when
+// the value is larger than the sum.
+static void compensatedAdd(double& sum, double& compensation, double value)
+{
+    const double newSum = sum + value;
+    if(std::abs(sum) >= std::abs(value)) compensation += ((sum - newSum) + value);
+    else                                 compensation += ((value - newSum) + sum);
+
+    sum = newSum;
+}
+
+static void compensatedAdd(
+    std::complex<double>& sum,
+    std::complex<double>& compensation,
+    const std::complex<double>& value)
+{
+    double sumReal = sum.real(), sumImag = sum.imag();
+    double compensationReal = compensation.real(), compensationImag = compensation.imag();
+
+    compensatedAdd(sumReal, compensationReal, value.real());
+    compensatedAdd(sumImag, compensationImag, value.imag());
+
+    sum = {sumReal, sumImag};
+    compensation = {compensationReal, compensationImag};
+}
 
 //
 // Block
@@ -19,6 +61,7 @@ class Accumulator: public VOLKBlock
     public:
         using Class = Accumulator<T>;
         using Fcn = OneToOneFcn<T,T>;
+        using Precise = typename PreciseType<T>::type;
 
         static Pothos::Block* make(Fcn fcn)
         {
@@ -27,27 +70,108 @@ class Accumulator: public VOLKBlock
 
         Accumulator(Fcn fcn):
             _fcn(fcn),
-            _accum(0)
+            _mode(Mode::Float),
+            _accum(0),
+            _preciseAccum(0),
+            _compensation(0),
+            _dumpSize(0),
+            _dumpMean(false),
+            _dumpScale(1),
+            _dumpAccum(0),
+            _dumpPhase(0),
+            _workStartPhase(0)
         {
             static const Pothos::DType dtype(typeid(T));
 
             this->setupInput(0, dtype);
             this->setupOutput(0, dtype, this->uid()); // Unique domain because of buffer forwarding
+            this->setupOutput("dump", dtype);
 
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, mode));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setMode));
             this->registerCall(this, POTHOS_FCN_TUPLE(Class, currentSum));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, preciseSum));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, dumpSize));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setDumpSize));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, dumpMode));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setDumpMode));
             this->registerCall(this, POTHOS_FCN_TUPLE(Class, reset));
 
             this->registerProbe("currentSum");
+            this->registerProbe("preciseSum");
+        }
+
+        std::string mode() const
+        {
+            switch(_mode)
+            {
+                case Mode::Double:      return "DOUBLE";
+                case Mode::Compensated: return "COMPENSATED";
+                default:                return "FLOAT";
+            }
+        }
+
+        // The running sum carries over to the new mode.
+        void setMode(const std::string& mode)
+        {
+            Mode newMode;
+            if(mode == "FLOAT")            newMode = Mode::Float;
+            else if(mode == "DOUBLE")      newMode = Mode::Double;
+            else if(mode == "COMPENSATED") newMode = Mode::Compensated;
+            else throw Pothos::InvalidArgumentException("Invalid mode: " + mode);
+
+            const auto sum = this->preciseSum();
+            _mode = newMode;
+
+            _accum = T(sum);
+            _preciseAccum = sum;
+            _compensation = Precise(0);
         }
 
         T currentSum() const
         {
-            return _accum;
+            return (Mode::Float == _mode) ? _accum : T(this->preciseSum());
+        }
+
+        Precise preciseSum() const
+        {
+            return (Mode::Float == _mode) ? Precise(_accum) : (_preciseAccum + _compensation);
+        }
+
+        size_t dumpSize() const
+        {
+            return _dumpSize;
+        }
+
+        // If non-zero, the sum or mean of each dumpSize inputs is output
+        // on the dump port.
+        void setDumpSize(size_t dumpSize)
+        {
+            _dumpSize = dumpSize;
+            this->_updateDumpScale();
+            this->_resetDump();
+        }
+
+        std::string dumpMode() const
+        {
+            return _dumpMean ? "MEAN" : "SUM";
+        }
+
+        void setDumpMode(const std::string& dumpMode)
+        {
+            if(dumpMode == "MEAN")     _dumpMean = true;
+            else if(dumpMode == "SUM") _dumpMean = false;
+            else throw Pothos::InvalidArgumentException("Invalid dump mode: " + dumpMode);
+
+            this->_updateDumpScale();
         }
 
         void reset()
         {
             _accum = 0;
+            _preciseAccum = 0;
+            _compensation = 0;
+            this->_resetDump();
         }
 
         void work() override
@@ -59,17 +183,133 @@ class Accumulator: public VOLKBlock
             auto output = this->output(0);
             auto buffer = input->takeBuffer();
 
-            T bufferAccum = 0;
-            _fcn(&bufferAccum, buffer, static_cast<unsigned int>(elems));
-            _accum += bufferAccum;
+            _workStartPhase = _dumpPhase;
+
+            if(_dumpSize > 0) this->_dumpWork(buffer, elems);
+            else if(Mode::Float == _mode)
+            {
+                T bufferAccum = 0;
+                _fcn(&bufferAccum, buffer, static_cast<unsigned int>(elems));
+                _accum += bufferAccum;
+            }
+            else
+            {
+                const T* bufferPtr = buffer;
+                for(size_t offset = 0; offset < elems; offset += TileSize)
+                {
+                    T tileAccum = 0;
+                    _fcn(&tileAccum,
+                         bufferPtr + offset,
+                         static_cast<unsigned int>(std::min(TileSize, elems - offset)));
+
+                    this->_addToTotal(tileAccum);
+                }
+            }
 
             input->consume(elems);
             output->postBuffer(std::move(buffer));
         }
 
+        // On the dump port, each label goes to the output whose span
+        // contains the labeled input.
+        void propagateLabels(const Pothos::InputPort* input) override
+        {
+            auto output = this->output(0);
+            auto dumpOutput = this->output("dump");
+
+            for(const auto& label: input->labels())
+            {
+                output->postLabel(label);
+
+                if(_dumpSize > 0)
+                {
+                    auto adjusted = label.toAdjusted(1, _dumpSize);
+                    adjusted.index = (label.index + _workStartPhase) / _dumpSize;
+                    dumpOutput->postLabel(adjusted);
+                }
+            }
+        }
+
     private:
+        enum class Mode
+        {
+            Float,
+            Double,
+            Compensated
+        };
+
         Fcn _fcn;
+        Mode _mode;
         T _accum;
+        Precise _preciseAccum;
+        Precise _compensation;
+
+        size_t _dumpSize;
+        bool _dumpMean;
+        T _dumpScale;
+        T _dumpAccum;
+        size_t _dumpPhase;
+        size_t _workStartPhase;
+
+        void _addToTotal(const T& value)
+        {
+            switch(_mode)
+            {
+                case Mode::Float:       _accum += value; break;
+                case Mode::Compensated: compensatedAdd(_preciseAccum, _compensation, Precise(value)); break;
+                default:                _preciseAccum += Precise(value); break;
+            }
+        }
+
+        void _updateDumpScale()
+        {
+            _dumpScale = (_dumpMean && (_dumpSize > 0)) ? T(1.0 / double(_dumpSize)) : T(1);
+        }
+
+        void _resetDump()
+        {
+            _dumpAccum = 0;
+            _dumpPhase = 0;
+        }
+
+        // Sums the buffer in spans that end at each dump boundary, which
+        // also gives the total without a second pass.
+        void _dumpWork(const T* buffer, size_t elems)
+        {
+            auto dumpOutput = this->output("dump");
+
+            // Dumps normally fit in the output buffer, but if not, they're
+            // posted in a new buffer instead.
+            const auto numDumps = (_dumpPhase + elems) / _dumpSize;
+            const bool fits = (numDumps <= dumpOutput->elements());
+            Pothos::BufferChunk dumpBuffer = fits ? dumpOutput->buffer() : Pothos::BufferChunk(dumpOutput->dtype(), numDumps);
+            T* dumps = dumpBuffer;
+
+            size_t numDumped = 0;
+            for(size_t offset = 0; offset < elems;)
+            {
+                const auto spanElems = std::min({elems - offset, _dumpSize - _dumpPhase, TileSize});
+
+                T spanAccum = 0;
+                _fcn(&spanAccum, buffer + offset, static_cast<unsigned int>(spanElems));
+                _dumpAccum += spanAccum;
+                this->_addToTotal(spanAccum);
+
+                offset += spanElems;
+                _dumpPhase += spanElems;
+                if(_dumpPhase == _dumpSize)
+                {
+                    dumps[numDumped++] = _dumpAccum * _dumpScale;
+                    this->_resetDump();
+                }
+            }
+
+            if(numDumped > 0)
+            {
+                if(fits) dumpOutput->produce(numDumped);
+                else     dumpOutput->postBuffer(std::move(dumpBuffer));
+            }
+        }
 };
 
 /***********************************************************************
@@ -81,6 +321,22 @@ class Accumulator: public VOLKBlock
  * </p>
  *
  * <p>
+ * In <b>FLOAT</b> mode, each buffer's sum is added to a float total,
+ * which loses precision as the total grows. In <b>DOUBLE</b> mode,
+ * each buffer is summed in tiles whose sums are added to a double
+ * total, and <b>COMPENSATED</b> mode also applies Kahan-Neumaier
+ * compensation to that total. In either, the full-precision total can
+ * be probed with <b>preciseSum</b>.
+ * </p>
+ *
+ * <p>
+ * If <b>dumpSize</b> is non-zero, the block also integrates and dumps,
+ * outputting the sum or mean of each <b>dumpSize</b> inputs on the
+ * <b>dump</b> port. Spans cross buffer boundaries, and each span is
+ * summed with the same VOLK kernel calls that update the total.
+ * </p>
+ *
+ * <p>
  * Underlying functions:
  * </p>
  *
@@ -97,7 +353,32 @@ class Accumulator: public VOLKBlock
  * |default "float32"
  * |preview disable
  *
+ * |param mode[Mode]
+ * |widget ComboBox(editable=false)
+ * |default "FLOAT"
+ * |option [Float] "FLOAT"
+ * |option [Double] "DOUBLE"
+ * |option [Compensated] "COMPENSATED"
+ * |preview enable
+ *
+ * |param dumpSize[Dump Size]
+ * The number of inputs in each dump output. If <b>0</b>, nothing is
+ * dumped.
+ * |widget SpinBox(minimum=0)
+ * |default 0
+ * |preview enable
+ *
+ * |param dumpMode[Dump Mode]
+ * |widget ComboBox(editable=false)
+ * |default "SUM"
+ * |option [Sum] "SUM"
+ * |option [Mean] "MEAN"
+ * |preview valid
+ *
  * |factory /volk/accumulator(dtype)
+ * |setter setMode(mode)
+ * |setter setDumpSize(dumpSize)
+ * |setter setDumpMode(dumpMode)
  **********************************************************************/
 static const std::string VOLKAccumulatorPath = "/volk/accumulator";
 
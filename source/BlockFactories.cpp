@@ -46,6 +46,13 @@
     if(doesDTypeMatch<InType0>(inDType0) && doesDTypeMatch<InType1>(inDType1) && doesDTypeMatch<OutType>(outDType)) \
         return TwoToOneBlock<InType0, InType1, OutType, InputPortType>::make(fcn,port0Name,port1Name);
 
+#define IfTypesThenBroadcastTwoToOneBlock(InType0,InType1,OutType,InputPortType,fcn,broadcastFcn,port0Name,port1Name) \
+    if(doesDTypeMatch<InType0>(inDType0) && doesDTypeMatch<InType1>(inDType1) && doesDTypeMatch<OutType>(outDType)) \
+        return TwoToOneBlock<InType0, InType1, OutType, InputPortType>::makeWithBroadcastFcn(fcn,broadcastFcn,port0Name,port1Name);
+
+#define IfTypeThenNToOneBlock(Type,fcn) \
+    if(doesDTypeMatch<Type>(dtype)) return NToOneBlock<Type>::make(fcn, numInputs);
+
 #define IfTypesThenTwoToOneScalarParamBlock(InType0,InType1,OutType,ScalarType,GetterName,SetterName,Fcn) \
     if(doesDTypeMatch<InType0>(inDType0) && doesDTypeMatch<InType1>(inDType1) && doesDTypeMatch<OutType>(outDType) && doesDTypeMatch<ScalarType>(scalarDType)) \
         return TwoToOneScalarParamBlock<InType0,InType1,OutType,ScalarType>::make( \
@@ -88,6 +95,7 @@ static Pothos::BlockRegistry registerVOLKACos(
  * <li><b>volk_64f_x2_add_64f</b></li>
  * <li><b>volk_32fc_32f_add_32fc</b></li>
  * <li><b>volk_32fc_x2_add_32fc</b></li>
+ * <li><b>volk_32f_s32f_add_32f</b> (broadcast)</li>
  * </ul>
  *
  * |category /Math/VOLK
@@ -109,7 +117,16 @@ static Pothos::BlockRegistry registerVOLKACos(
  * |default "float64"
  * |preview disable
  *
+ * |param broadcastSize[Broadcast Size]
+ * If non-zero, each value of the second input is applied to this many
+ * values of the first input, so the second input can run at a lower
+ * rate.
+ * |widget SpinBox(minimum=0)
+ * |default 0
+ * |preview enable
+ *
  * |factory /volk/add(input0DType,input1DType,outputDType)
+ * |setter setBroadcastSize(broadcastSize)
  **********************************************************************/
 static const std::string VOLKAddPath = "/volk/add";
 
@@ -121,7 +138,7 @@ static Pothos::Block* makeAdd(
 #define IfTypesThenAdd(in0,in1,out,fcn) \
     IfTypesThenTwoToOneBlock(in0,in1,out,size_t,fcn,0,1)
 
-    IfTypesThenAdd(float,float,float,volk_32f_x2_add_32f)
+    IfTypesThenBroadcastTwoToOneBlock(float,float,float,size_t,volk_32f_x2_add_32f,volk_32f_s32f_add_32f,0,1)
     IfTypesThenAdd(float,double,double,volk_32f_64f_add_64f)
     IfTypesThenAdd(double,double,double,volk_64f_x2_add_64f)
     IfTypesThenAdd(std::complex<float>,std::complex<float>,std::complex<float>,volk_32fc_x2_add_32fc)
@@ -137,6 +154,57 @@ static Pothos::BlockRegistry registerVOLKAdd(
     VOLKAddPath,
     &makeAdd);
 
+/***********************************************************************
+ * |PothosDoc Add (N-Input) (VOLK)
+ *
+ * <p>
+ * Adds all inputs in a single block, folding each input into the output
+ * in cache-sized tiles.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_add_32f</b></li>
+ * <li><b>volk_64f_x2_add_64f</b></li>
+ * <li><b>volk_32fc_x2_add_32fc</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math plus sum
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param numInputs[Num Inputs]
+ * |widget SpinBox(minimum=2)
+ * |default 2
+ * |preview disable
+ *
+ * |factory /volk/add_n(dtype,numInputs)
+ **********************************************************************/
+static const std::string VOLKAddNPath = "/volk/add_n";
+
+static Pothos::Block* makeAddN(
+    const Pothos::DType& dtype,
+    size_t numInputs)
+{
+    IfTypeThenNToOneBlock(float,volk_32f_x2_add_32f)
+    IfTypeThenNToOneBlock(double,volk_64f_x2_add_64f)
+    IfTypeThenNToOneBlock(std::complex<float>,volk_32fc_x2_add_32fc)
+
+    throw InvalidDTypeException(VOLKAddNPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKAddN(
+    VOLKAddNPath,
+    &makeAddN);
+
 /***********************************************************************
  * |PothosDoc Scalar Add (VOLK)
  *
@@ -243,8 +311,15 @@ static Pothos::BlockRegistry registerVOLKATan(
  * |default 1.0
  * |preview enable
  *
+ * |param decimation[Decimation]
+ * Only every Nth output is computed and kept, starting with the first.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview enable
+ *
  * |factory /volk/atan2()
  * |setter setNormalizationFactor(normalizationFactor)
+ * |setter setDecimation(decimation)
  **********************************************************************/
 static Pothos::BlockRegistry registerVOLKATan2(
     "/volk/atan2",
@@ -276,50 +351,6 @@ static Pothos::BlockRegistry registerVOLKBinarySlicer(
     Pothos::Callable(OneToOneBlock<float,int8_t>::make)
         .bind(volk_32f_binary_slicer_8i, 0));
 
-/***********************************************************************
- * |PothosDoc Calc Spectral Noise Floor (VOLK)
- *
- * <p>
- * Computes the spectral noise floor of an input power spectrum.
- * </p>
- *
- * <p>
- * Calculates the spectral noise floor of an input power spectrum by
- * determining the mean of the input power spectrum, then
- * recalculating the mean excluding any power spectrum values that
- * exceed the mean by the <b>spectralExclusionValue</b> (in dB).  Provides a
- * rough estimation of the signal noise floor.
- * </p>
- *
- * <p>
- * Outputs the noise floor of the input spectrum in dB.
- * </p>
- *
- * <p>
- * Underlying function: <b>volk_32f_s32f_calc_spectral_noise_floor_32f</b>
- * </p>
- *
- * |category /VOLK
- * |keywords rf spectrum
- *
- * |param spectralExclusionValue[Spectral Exclusion Value]
- * The number of dB above the noise floor that a data point must be to be
- * excluded from the noise floor calculation.
- * |widget DoubleSpinBox(decimals=3)
- * |units dB
- * |default 20.0
- * |preview enable
- *
- * |factory /volk/calc_spectral_noise_floor()
- * |setter setSpectralExclusionValue(spectralExclusionValue)
- **********************************************************************/
-static Pothos::BlockRegistry registerVOLKCalcSpectralNoiseFloor(
-    "/volk/calc_spectral_noise_floor",
-    Pothos::Callable(OneToOneScalarParamBlock<float,float,float>::make)
-        .bind(volk_32f_s32f_calc_spectral_noise_floor_32f, 0)
-        .bind("spectralExclusionValue", 1)
-        .bind("setSpectralExclusionValue", 2));
-
 /***********************************************************************
  * |PothosDoc Conjugate (VOLK)
  *
@@ -425,118 +456,6 @@ static Pothos::BlockRegistry registerVOLKConvert(
     VOLKConvertPath,
     &makeConvert);
 
-/***********************************************************************
- * |PothosDoc Convert (Custom Scalar) (VOLK)
- *
- * <p>
- * Converts all values and applies a given scalar. Whether the scalar is
- * multiplied or divided depends on the conversion and is listed below.
- * </p>
- *
- * <p>
- * Supported conversions:
- * </p>
- *
- * <ul>
- *   <li>
- *     float32 -> int8 (float32 scalar)
- *     <ul>
- *       <li>Underlying function: <b>volk_f32_sf32_convert_8i</b></li>
- *       <li>Multiplies all inputs by <b>scalar</b>.</li>
- *       <li>Truncates all scaled values to fit inside an <b>int8</b>.</li>
- *     </ul>
- *   </li>
- *   <li>
- *     float32 -> int16 (float32 scalar)
- *     <ul>
- *       <li>Underlying function: <b>volk_f32_sf32_convert_16i</b></li>
- *       <li>Multiplies all inputs by <b>scalar</b>.</li>
- *       <li>Truncates all scaled values to fit inside an <b>int16</b>.</li>
- *     </ul>
- *   </li>
- *   <li>
- *     float32 -> int32 (float32 scalar)
- *     <ul>
- *       <li>Underlying function: <b>volk_32i_s32f_convert_f32</b></li>
- *       <li>Multiplies all inputs by <b>scalar</b>.</li>
- *       <li>Truncates all scaled values to fit inside an <b>int32</b>.</li>
- *     </ul>
- *   </li>
- *   <li>
- *     int8 -> float32 (float32 scalar)
- *     <ul>
- *       <li>Underlying function: <b>volk_8i_s32f_convert_f32</b></li>
- *       <li>Divides all inputs by <b>scalar</b>.</li>
- *     </ul>
- *   </li>
- *   <li>
- *     int16 -> float32 (float32 scalar)
- *     <ul>
- *       <li>Underlying function: <b>volk_16i_s32f_convert_f32</b></li>
- *       <li>Divides all inputs by <b>scalar</b>.</li>
- *     </ul>
- *   </li>
- *   <li>
- *     int32 -> float32 (float32 scalar)
- *     <ul>
- *       <li>Underlying function: <b>volk_32i_s32f_convert_f32</b></li>
- *       <li>Divides all inputs by <b>scalar</b>.</li>
- *     </ul>
- *   </li>
- * </ul>
- *
- * |category /Convert/VOLK
- * |category /VOLK/Convert
- * |keywords type
- *
- * |param inputDType[Data Type In]
- * |widget DTypeChooser(int8=1,int16=1,int32=1,float32=1)
- * |default "int32"
- * |preview disable
- *
- * |param outputDType[Data Type Out]
- * |widget DTypeChooser(int8=1,int16=1,int32=1,float32=1)
- * |default "float32"
- * |preview disable
- *
- * |param scalar[Scalar] A scalar to apply to each input post-conversion.
- * |widget DoubleSpinBox(decimals=3)
- * |default 1.0
- * |preview enable
- *
- * |factory /volk/convert_scaled(inputDType,outputDType)
- * |setter setScalar(scalar)
- **********************************************************************/
-static const std::string VOLKConvertScaledPath = "/volk/convert_scaled";
-
-static Pothos::Block* makeConvertScaled(
-    const Pothos::DType& inDType,
-    const Pothos::DType& outDType)
-{
-#define IfTypesThenConvertScaledBlock(InType,OutType,Fcn) \
-    if(doesDTypeMatch<InType>(inDType) && doesDTypeMatch<OutType>(outDType)) \
-        return OneToOneScalarParamBlock<InType,OutType,float>::make( \
-            Fcn, \
-            "scalar", \
-            "setScalar");
-
-    IfTypesThenConvertScaledBlock(float,int8_t,volk_32f_s32f_convert_8i)
-    IfTypesThenConvertScaledBlock(float,int16_t,volk_32f_s32f_convert_16i)
-    IfTypesThenConvertScaledBlock(float,int32_t,volk_32f_s32f_convert_32i)
-    IfTypesThenConvertScaledBlock(int8_t,float,volk_8i_s32f_convert_32f)
-    IfTypesThenConvertScaledBlock(int16_t,float,volk_16i_s32f_convert_32f)
-    IfTypesThenConvertScaledBlock(int32_t,float,volk_32i_s32f_convert_32f)
-
-    throw InvalidDTypeException(
-        VOLKConvertScaledPath,
-        inDType,
-        outDType);
-}
-
-static Pothos::BlockRegistry registerVOLKConvertScaled(
-    VOLKConvertScaledPath,
-    &makeConvertScaled);
-
 /***********************************************************************
  * |PothosDoc Cos (VOLK)
  *
@@ -940,7 +859,14 @@ static Pothos::BlockRegistry registerVOLKDeinterleaveScaled(
  * |default "float32"
  * |preview disable
  *
+ * |param decimation[Decimation]
+ * Only every Nth output is computed and kept, starting with the first.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview enable
+ *
  * |factory /volk/divide(dtype)
+ * |setter setDecimation(decimation)
  **********************************************************************/
 static const std::string VOLKDividePath = "/volk/divide";
 
@@ -1092,7 +1018,14 @@ static Pothos::BlockRegistry registerVOLKInvSqrt(
  * |category /VOLK/Math
  * |keywords math trig
  *
+ * |param decimation[Decimation]
+ * Only every Nth output is computed and kept, starting with the first.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview enable
+ *
  * |factory /volk/log2()
+ * |setter setDecimation(decimation)
  **********************************************************************/
 static Pothos::BlockRegistry registerVOLKLog2(
     "/volk/log2",
@@ -1121,7 +1054,14 @@ static Pothos::BlockRegistry registerVOLKLog2(
  * |default "float32"
  * |preview disable
  *
+ * |param decimation[Decimation]
+ * Only every Nth output is computed and kept, starting with the first.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview enable
+ *
  * |factory /volk/magnitude(dtype)
+ * |setter setDecimation(decimation)
  **********************************************************************/
 static const std::string VOLKMagnitudePath = "/volk/magnitude";
 
@@ -1198,6 +1138,54 @@ static Pothos::BlockRegistry registerVOLKMax(
     VOLKMaxPath,
     &makeMax);
 
+/***********************************************************************
+ * |PothosDoc Max (N-Input) (VOLK)
+ *
+ * <p>
+ * Outputs the maximum of all inputs in a single block, folding each
+ * input into the output in cache-sized tiles.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_max_32f</b></li>
+ * <li><b>volk_64f_x2_max_64f</b></li>
+ * </ul>
+ *
+ * |category /Stream/VOLK
+ * |category /VOLK/Stream
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param numInputs[Num Inputs]
+ * |widget SpinBox(minimum=2)
+ * |default 2
+ * |preview disable
+ *
+ * |factory /volk/max_n(dtype,numInputs)
+ **********************************************************************/
+static const std::string VOLKMaxNPath = "/volk/max_n";
+
+static Pothos::Block* makeMaxN(
+    const Pothos::DType& dtype,
+    size_t numInputs)
+{
+    IfTypeThenNToOneBlock(float,volk_32f_x2_max_32f)
+    IfTypeThenNToOneBlock(double,volk_64f_x2_max_64f)
+
+    throw InvalidDTypeException(VOLKMaxNPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKMaxN(
+    VOLKMaxNPath,
+    &makeMaxN);
+
 /***********************************************************************
  * |PothosDoc Max* (VOLK)
  *
@@ -1262,6 +1250,54 @@ static Pothos::BlockRegistry registerVOLKMin(
     VOLKMinPath,
     &makeMin);
 
+/***********************************************************************
+ * |PothosDoc Min (N-Input) (VOLK)
+ *
+ * <p>
+ * Outputs the minimum of all inputs in a single block, folding each
+ * input into the output in cache-sized tiles.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_min_32f</b></li>
+ * <li><b>volk_64f_x2_min_64f</b></li>
+ * </ul>
+ *
+ * |category /Stream/VOLK
+ * |category /VOLK/Stream
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param numInputs[Num Inputs]
+ * |widget SpinBox(minimum=2)
+ * |default 2
+ * |preview disable
+ *
+ * |factory /volk/min_n(dtype,numInputs)
+ **********************************************************************/
+static const std::string VOLKMinNPath = "/volk/min_n";
+
+static Pothos::Block* makeMinN(
+    const Pothos::DType& dtype,
+    size_t numInputs)
+{
+    IfTypeThenNToOneBlock(float,volk_32f_x2_min_32f)
+    IfTypeThenNToOneBlock(double,volk_64f_x2_min_64f)
+
+    throw InvalidDTypeException(VOLKMinNPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKMinN(
+    VOLKMinNPath,
+    &makeMinN);
+
 /***********************************************************************
  * |PothosDoc Multiply (VOLK)
  *
@@ -1275,6 +1311,7 @@ static Pothos::BlockRegistry registerVOLKMin(
  * <li><b>volk_16ic_x2_multiply_16ic</b></li>
  * <li><b>volk_32fc_x2_multiply_32fc</b></li>
  * <li><b>volk_32fc_32f_multiply_32fc</b></li>
+ * <li><b>volk_32fc_s32fc_multiply_32fc</b> (broadcast)</li>
  * </ul>
  *
  * |category /Math/VOLK
@@ -1296,7 +1333,16 @@ static Pothos::BlockRegistry registerVOLKMin(
  * |default "float64"
  * |preview disable
  *
+ * |param broadcastSize[Broadcast Size]
+ * If non-zero, each value of the second input is applied to this many
+ * values of the first input, so the second input can run at a lower
+ * rate.
+ * |widget SpinBox(minimum=0)
+ * |default 0
+ * |preview enable
+ *
  * |factory /volk/multiply(input0DType,input1DType,outputDType)
+ * |setter setBroadcastSize(broadcastSize)
  **********************************************************************/
 static const std::string VOLKMultiplyPath = "/volk/multiply";
 
@@ -1311,7 +1357,7 @@ static Pothos::Block* makeMultiply(
     IfTypesThenMultiply(float,double,double,volk_32f_64f_multiply_64f)
     IfTypesThenMultiply(double,double,double,volk_64f_x2_multiply_64f)
     IfTypesThenMultiply(std::complex<int16_t>,std::complex<int16_t>,std::complex<int16_t>,volk_16ic_x2_multiply_16ic)
-    IfTypesThenMultiply(std::complex<float>,std::complex<float>,std::complex<float>,volk_32fc_x2_multiply_32fc)
+    IfTypesThenBroadcastTwoToOneBlock(std::complex<float>,std::complex<float>,std::complex<float>,size_t,volk_32fc_x2_multiply_32fc,volk_32fc_s32fc_multiply_32fc,0,1)
     IfTypesThenMultiply(std::complex<float>,float,std::complex<float>,volk_32fc_32f_multiply_32fc)
 
     throw InvalidDTypeException(
@@ -1324,6 +1370,59 @@ static Pothos::BlockRegistry registerVOLKMultiply(
     VOLKMultiplyPath,
     &makeMultiply);
 
+/***********************************************************************
+ * |PothosDoc Multiply (N-Input) (VOLK)
+ *
+ * <p>
+ * Multiplies all inputs in a single block, folding each input into the output
+ * in cache-sized tiles.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_multiply_32f</b></li>
+ * <li><b>volk_64f_x2_multiply_64f</b></li>
+ * <li><b>volk_16ic_x2_multiply_16ic</b></li>
+ * <li><b>volk_32fc_x2_multiply_32fc</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math product
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float=1,cint16=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param numInputs[Num Inputs]
+ * |widget SpinBox(minimum=2)
+ * |default 2
+ * |preview disable
+ *
+ * |factory /volk/multiply_n(dtype,numInputs)
+ **********************************************************************/
+static const std::string VOLKMultiplyNPath = "/volk/multiply_n";
+
+static Pothos::Block* makeMultiplyN(
+    const Pothos::DType& dtype,
+    size_t numInputs)
+{
+    IfTypeThenNToOneBlock(float,volk_32f_x2_multiply_32f)
+    IfTypeThenNToOneBlock(double,volk_64f_x2_multiply_64f)
+    IfTypeThenNToOneBlock(std::complex<int16_t>,volk_16ic_x2_multiply_16ic)
+    IfTypeThenNToOneBlock(std::complex<float>,volk_32fc_x2_multiply_32fc)
+
+    throw InvalidDTypeException(VOLKMultiplyNPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKMultiplyN(
+    VOLKMultiplyNPath,
+    &makeMultiplyN);
+
 /***********************************************************************
  * |PothosDoc Multiply Conjugate (VOLK)
  *
@@ -1574,37 +1673,6 @@ static Pothos::BlockRegistry registerVOLKPower(
         .bind("power", 1)
         .bind("setPower", 2));
 
-/***********************************************************************
- * |PothosDoc Power Spectrum (VOLK)
- *
- * <p>
- * Calculates the log10 power value for each input.
- * </p>
- *
- * <p>
- * Underlying function: <b>volk_32fc_s32f_power_spectrum_32f</b>
- * </p>
- *
- * |category /Math/VOLK
- * |category /VOLK/Math
- * |keywords math rf
- *
- * |param normalizationFactor[Normalization Factor]
- * A value multiplied to all outputs.
- * |widget DoubleSpinBox(decimals=3)
- * |default 1.0
- * |preview enable
- *
- * |factory /volk/power_spectrum()
- * |setter setNormalizationFactor(normalizationFactor)
- **********************************************************************/
-static Pothos::BlockRegistry registerVOLKPowerSpectrum(
-    "/volk/power_spectrum",
-    Pothos::Callable(OneToOneScalarParamBlock<std::complex<float>,float,float>::make)
-        .bind(volk_32fc_s32f_power_spectrum_32f, 0)
-        .bind("normalizationFactor", 1)
-        .bind("setNormalizationFactor", 2));
-
 /***********************************************************************
  * |PothosDoc Bitwise Reverse (VOLK)
  *
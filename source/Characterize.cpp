@@ -0,0 +1,498 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "FallbackKernels.hpp"
+#include "ToDBKernels.hpp"
+
+#include <Pothos/Exception.hpp>
+#include <Pothos/Object/Containers.hpp>
+#include <Pothos/Plugin.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <regex>
+#include <string>
+#include <vector>
+
+//
+// Characterized kernels
+//
+
+// Inputs are swept evenly across this range, or evenly across its
+// exponents if log-spaced.
+struct Domain
+{
+    double min;
+    double max;
+    bool logSpaced;
+};
+
+static Domain Linear(double min, double max)
+{
+    return {min, max, false};
+}
+
+static Domain LogSpaced(double min, double max)
+{
+    return {min, max, true};
+}
+
+struct Implementation
+{
+    std::string name;
+    bool aligned;
+    std::function<void(float*, const float*, const float*, unsigned int)> run;
+};
+
+// Each kernel takes one or two float arguments per output, either as
+// separate buffers or interleaved as a complex buffer.
+struct CharacterizedKernel
+{
+    const char* name;
+    size_t numArgs;
+    bool complexInput;
+    Domain domains[2];
+    std::vector<Implementation>(*getImplementations)(void);
+    double(*reference)(double, double);
+};
+
+using ManualFcn = void(*)(float*, const float*, const float*, unsigned int, const char*);
+
+static std::vector<Implementation> getVOLKImplementations(
+    const volk_func_desc_t& desc,
+    ManualFcn manualFcn)
+{
+    std::vector<Implementation> impls;
+    for(size_t i = 0; i < desc.n_impls; ++i)
+    {
+        const std::string implName(desc.impl_names[i]);
+        impls.push_back(
+        {
+            implName,
+            bool(desc.impl_alignment[i]),
+            [manualFcn, implName](float* out, const float* in0, const float* in1, unsigned int num_points)
+            {
+                manualFcn(out, in0, in1, num_points, implName.c_str());
+            }
+        });
+    }
+
+    return impls;
+}
+
+// Each implementation is called through VOLK's manual dispatcher. In
+// the call, out, in0, in1, n, and impl are the arguments, and in the
+// double-precision reference, x and y are.
+#define CharacterizedVOLKKernel(kernel, numArgs, complexInput, domain0, domain1, call, reference) \
+    { \
+        #kernel, numArgs, complexInput, {domain0, domain1}, \
+        []() \
+        { \
+            return getVOLKImplementations( \
+                kernel ## _get_func_desc(), \
+                [](float* out, const float* in0, const float* in1, unsigned int n, const char* impl) \
+                { \
+                    (void)in1; \
+                    call; \
+                }); \
+        }, \
+        [](double x, double y) -> double \
+        { \
+            (void)y; \
+            return reference; \
+        } \
+    }
+
+#define UnaryVOLKKernel(kernel, domain, reference) \
+    CharacterizedVOLKKernel(kernel, 1, false, domain, domain, kernel ## _manual(out, in0, n, impl), reference)
+
+#define ComplexVOLKKernel(kernel, domain, call, reference) \
+    CharacterizedVOLKKernel(kernel, 2, true, domain, domain, call, reference)
+
+static const lv_32fc_t* asComplex(const float* input)
+{
+    return reinterpret_cast<const lv_32fc_t*>(input);
+}
+
+#ifndef HAVE_32F_EXP
+// The module's fallback is used, so its implementations are
+// characterized instead of VOLK's.
+static std::vector<Implementation> getFallbackExpImplementations()
+{
+    std::vector<Implementation> impls;
+    for(const auto& table: Fallback::getSupportedKernelTables())
+    {
+        const auto fcn = table.second.volk_32f_exp_32f;
+        impls.push_back(
+        {
+            "fallback_" + table.first,
+            false,
+            [fcn](float* out, const float* in0, const float*, unsigned int num_points)
+            {
+                fcn(out, in0, num_points);
+            }
+        });
+    }
+
+    return impls;
+}
+#endif
+
+// /volk/to_db's FAST precision replaces volk_32f_log2_32f with this, so
+// it's characterized alongside it.
+static std::vector<Implementation> getFastLog2Implementations()
+{
+    std::vector<Implementation> impls;
+    for(const auto& table: ToDBKernels::getSupportedKernelTables())
+    {
+        const auto fcn = table.second.fastLog2;
+        impls.push_back(
+        {
+            table.first,
+            false,
+            [fcn](float* out, const float* in0, const float*, unsigned int num_points)
+            {
+                fcn(out, in0, num_points);
+            }
+        });
+    }
+
+    return impls;
+}
+
+// Only kernels with one float32 output per float32 or complex float32
+// input are characterized. Of this module's other non-exact kernels:
+//
+// * volk_32fc_x2_multiply_32fc, volk_32fc_x2_multiply_conjugate_32fc and
+//   volk_32fc_x2_divide_32fc output complex values, whose components can
+//   cancel, so their per-component ULP error is unbounded even when the
+//   result is accurate relative to its magnitude.
+// * volk_32f_accumulator_s32f, volk_32fc_accumulator_s32fc and
+//   volk_32f_x3_sum_of_poly_32f output a single sum per call, whose
+//   error depends on the number of points summed.
+//
+// The rest are exact or only convert.
+static const std::vector<CharacterizedKernel>& getCharacterizedKernels()
+{
+    static const std::vector<CharacterizedKernel> CharacterizedKernels =
+    {
+        UnaryVOLKKernel(volk_32f_acos_32f, Linear(-1.0, 1.0), std::acos(x)),
+        UnaryVOLKKernel(volk_32f_asin_32f, Linear(-1.0, 1.0), std::asin(x)),
+        UnaryVOLKKernel(volk_32f_atan_32f, Linear(-1000.0, 1000.0), std::atan(x)),
+        UnaryVOLKKernel(volk_32f_cos_32f, Linear(-100.0, 100.0), std::cos(x)),
+#ifdef HAVE_32F_EXP
+        UnaryVOLKKernel(volk_32f_exp_32f, Linear(-87.0, 88.0), std::exp(x)),
+#else
+        {
+            "volk_32f_exp_32f", 1, false, {Linear(-87.0, 88.0), Linear(-87.0, 88.0)},
+            &getFallbackExpImplementations,
+            [](double x, double) -> double { return std::exp(x); }
+        },
+#endif
+        UnaryVOLKKernel(volk_32f_expfast_32f, Linear(-87.0, 88.0), std::exp(x)),
+        UnaryVOLKKernel(volk_32f_invsqrt_32f, LogSpaced(1e-30, 1e30), 1.0 / std::sqrt(x)),
+        UnaryVOLKKernel(volk_32f_log2_32f, LogSpaced(1e-30, 1e30), std::log2(x)),
+        {
+            "fast_log2", 1, false, {LogSpaced(1e-30, 1e30), LogSpaced(1e-30, 1e30)},
+            &getFastLog2Implementations,
+            [](double x, double) -> double { return std::log2(x); }
+        },
+        // The kernel works in place, so as in /volk/normalize, each call
+        // copies the inputs first.
+        CharacterizedVOLKKernel(
+            volk_32f_s32f_normalize, 1, false,
+            LogSpaced(1e-30, 1e30), LogSpaced(1e-30, 1e30),
+            std::copy(in0, in0 + n, out); volk_32f_s32f_normalize_manual(out, 3.0f, n, impl),
+            x / 3.0),
+        CharacterizedVOLKKernel(
+            volk_32f_s32f_power_32f, 1, false,
+            LogSpaced(1e-10, 1e10), LogSpaced(1e-10, 1e10),
+            volk_32f_s32f_power_32f_manual(out, in0, 2.5f, n, impl),
+            std::pow(x, 2.5)),
+        UnaryVOLKKernel(volk_32f_sin_32f, Linear(-100.0, 100.0), std::sin(x)),
+        UnaryVOLKKernel(volk_32f_sqrt_32f, LogSpaced(1e-30, 1e30), std::sqrt(x)),
+        UnaryVOLKKernel(volk_32f_tan_32f, Linear(-1.5, 1.5), std::tan(x)),
+        UnaryVOLKKernel(volk_32f_tanh_32f, Linear(-10.0, 10.0), std::tanh(x)),
+        CharacterizedVOLKKernel(
+            volk_32f_x2_divide_32f, 2, false,
+            LogSpaced(1e-10, 1e10), LogSpaced(1e-10, 1e10),
+            volk_32f_x2_divide_32f_manual(out, in0, in1, n, impl),
+            x / y),
+        // VOLK takes the exponents first.
+        CharacterizedVOLKKernel(
+            volk_32f_x2_pow_32f, 2, false,
+            LogSpaced(1e-3, 1e3), Linear(-10.0, 10.0),
+            volk_32f_x2_pow_32f_manual(out, in1, in0, n, impl),
+            std::pow(x, y)),
+        ComplexVOLKKernel(
+            volk_32fc_magnitude_32f,
+            Linear(-1000.0, 1000.0),
+            volk_32fc_magnitude_32f_manual(out, asComplex(in0), n, impl),
+            std::sqrt((x * x) + (y * y))),
+        ComplexVOLKKernel(
+            volk_32fc_magnitude_squared_32f,
+            Linear(-1000.0, 1000.0),
+            volk_32fc_magnitude_squared_32f_manual(out, asComplex(in0), n, impl),
+            (x * x) + (y * y)),
+        // The normalization factor and RBW only offset the dB values, so
+        // they're left at 1.
+        ComplexVOLKKernel(
+            volk_32fc_s32f_power_spectrum_32f,
+            Linear(-1000.0, 1000.0),
+            volk_32fc_s32f_power_spectrum_32f_manual(out, asComplex(in0), 1.0f, n, impl),
+            10.0 * std::log10((x * x) + (y * y))),
+        ComplexVOLKKernel(
+            volk_32fc_s32f_x2_power_spectral_density_32f,
+            Linear(-1000.0, 1000.0),
+            volk_32fc_s32f_x2_power_spectral_density_32f_manual(out, asComplex(in0), 1.0f, 1.0, n, impl),
+            10.0 * std::log10((x * x) + (y * y))),
+        ComplexVOLKKernel(
+            volk_32fc_s32f_atan2_32f,
+            Linear(-1.0, 1.0),
+            volk_32fc_s32f_atan2_32f_manual(out, asComplex(in0), 1.0f, n, impl),
+            std::atan2(y, x)),
+    };
+
+    return CharacterizedKernels;
+}
+
+//
+// Measurement
+//
+
+// VOLK's aligned implementations need aligned buffers.
+template <typename T>
+class VOLKBuffer
+{
+    public:
+        explicit VOLKBuffer(size_t size):
+            _data(static_cast<T*>(volk_malloc(std::max<size_t>(size, 1) * sizeof(T), volk_get_alignment()))),
+            _size(size)
+        {
+            if(!_data) throw Pothos::OutOfMemoryException("Failed to allocate characterization buffer.");
+        }
+
+        ~VOLKBuffer()
+        {
+            volk_free(_data);
+        }
+
+        VOLKBuffer(const VOLKBuffer&) = delete;
+        VOLKBuffer& operator=(const VOLKBuffer&) = delete;
+
+        T* data() const
+        {
+            return _data;
+        }
+
+        size_t size() const
+        {
+            return _size;
+        }
+
+        T& operator[](size_t index) const
+        {
+            return _data[index];
+        }
+
+    private:
+        T* _data;
+        size_t _size;
+};
+
+static double sweepValue(
+    const Domain& domain,
+    size_t index,
+    size_t numPoints)
+{
+    const double position = (numPoints > 1) ? (double(index) / double(numPoints - 1)) : 0.0;
+
+    if(domain.logSpaced) return domain.min * std::pow(domain.max / domain.min, position);
+    return domain.min + (position * (domain.max - domain.min));
+}
+
+// The distance from the reference in units of the float32 spacing at
+// the reference, or infinity if only one is finite.
+static double ulpError(
+    float actual,
+    double expected)
+{
+    constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+    if(std::isnan(expected)) return std::isnan(actual) ? 0.0 : Infinity;
+    if(!std::isfinite(actual) || std::isinf(expected)) return (double(actual) == expected) ? 0.0 : Infinity;
+
+    const float magnitude = std::min(
+        std::abs(float(expected)),
+        std::numeric_limits<float>::max());
+    const double ulp = double(std::nextafter(magnitude, std::numeric_limits<float>::max())) - double(magnitude);
+    const double fallbackUlp = double(magnitude) - double(std::nextafter(magnitude, 0.0f));
+
+    return std::abs(double(actual) - expected) / ((ulp > 0.0) ? ulp : fallbackUlp);
+}
+
+static Pothos::ObjectKwargs getDomainInfo(const Domain& domain)
+{
+    Pothos::ObjectKwargs info;
+    info["min"] = Pothos::Object(domain.min);
+    info["max"] = Pothos::Object(domain.max);
+    info["logSpaced"] = Pothos::Object(domain.logSpaced);
+
+    return info;
+}
+
+static Pothos::ObjectKwargs characterizeKernel(
+    const CharacterizedKernel& kernel,
+    size_t sweepPoints,
+    const std::vector<size_t>& sizes,
+    double minSeconds)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // The second argument is spread across its domain in a different
+    // order than the first, so pairs cover the whole plane.
+    constexpr size_t SecondArgStride = 40503;
+
+    const size_t floatsPerPoint = kernel.complexInput ? 2 : 1;
+    const size_t maxSize = std::max(sweepPoints, *std::max_element(sizes.begin(), sizes.end()));
+
+    VOLKBuffer<float> input0(maxSize * floatsPerPoint);
+    VOLKBuffer<float> input1(kernel.complexInput ? 0 : maxSize);
+    VOLKBuffer<float> output(maxSize);
+    std::vector<double> expected(sweepPoints);
+
+    for(size_t i = 0; i < maxSize; ++i)
+    {
+        const size_t sweepIndex = i % sweepPoints;
+        const float x = float(sweepValue(kernel.domains[0], sweepIndex, sweepPoints));
+        const float y = float(sweepValue(kernel.domains[1], (sweepIndex * SecondArgStride) % sweepPoints, sweepPoints));
+
+        if(kernel.complexInput)
+        {
+            input0[2*i] = x;
+            input0[(2*i)+1] = y;
+        }
+        else
+        {
+            input0[i] = x;
+            if(kernel.numArgs > 1) input1[i] = y;
+        }
+
+        // The reference uses the float32 inputs the kernel sees.
+        if(i < sweepPoints) expected[i] = kernel.reference(x, y);
+    }
+
+    Pothos::ObjectVector domains;
+    for(size_t arg = 0; arg < kernel.numArgs; ++arg) domains.emplace_back(getDomainInfo(kernel.domains[arg]));
+
+    Pothos::ObjectVector implInfos;
+    for(const auto& impl: kernel.getImplementations())
+    {
+        impl.run(output.data(), input0.data(), input1.data(), static_cast<unsigned int>(sweepPoints));
+
+        double maxULP = 0.0;
+        double sumULP = 0.0;
+        size_t numFinite = 0;
+        for(size_t i = 0; i < sweepPoints; ++i)
+        {
+            const double error = ulpError(output[i], expected[i]);
+            if(!std::isfinite(error)) continue;
+
+            maxULP = std::max(maxULP, error);
+            sumULP += error;
+            ++numFinite;
+        }
+
+        Pothos::ObjectVector throughputs;
+        for(const auto size: sizes)
+        {
+            // Called until minSeconds have passed, after one untimed call
+            // to warm the caches.
+            impl.run(output.data(), input0.data(), input1.data(), static_cast<unsigned int>(size));
+
+            size_t numCalls = 0;
+            const auto start = Clock::now();
+            std::chrono::duration<double> elapsed(0.0);
+            do
+            {
+                impl.run(output.data(), input0.data(), input1.data(), static_cast<unsigned int>(size));
+                ++numCalls;
+                elapsed = Clock::now() - start;
+            } while(elapsed.count() < minSeconds);
+
+            Pothos::ObjectKwargs throughput;
+            throughput["size"] = Pothos::Object(size);
+            throughput["pointsPerSecond"] = Pothos::Object(double(numCalls * size) / elapsed.count());
+            throughputs.emplace_back(throughput);
+        }
+
+        Pothos::ObjectKwargs implInfo;
+        implInfo["name"] = Pothos::Object(impl.name);
+        implInfo["aligned"] = Pothos::Object(impl.aligned);
+        implInfo["maxULP"] = Pothos::Object(maxULP);
+        implInfo["meanULP"] = Pothos::Object((numFinite > 0) ? (sumULP / double(numFinite)) : 0.0);
+        implInfo["nonFinite"] = Pothos::Object(sweepPoints - numFinite);
+        implInfo["throughput"] = Pothos::Object(throughputs);
+        implInfos.emplace_back(implInfo);
+    }
+
+    Pothos::ObjectKwargs info;
+    info["name"] = Pothos::Object(std::string(kernel.name));
+    info["domains"] = Pothos::Object(domains);
+    info["implementations"] = Pothos::Object(implInfos);
+
+    return info;
+}
+
+//
+// Plugin
+//
+
+// For each characterized kernel whose name matches kernelRegex, and
+// each of its implementations, returns the max and mean ULP error
+// against a double-precision reference over sweepPoints inputs, the
+// number of non-finite outputs where the reference is finite or vice
+// versa, and the throughput at each size.
+static Pothos::ObjectKwargs characterizeVOLKKernels(
+    const std::string& kernelRegex,
+    size_t sweepPoints,
+    const std::vector<size_t>& sizes,
+    double minSeconds)
+{
+    if(0 == sweepPoints) throw Pothos::InvalidArgumentException("The sweep must have at least one point.");
+    if(sizes.empty() || (std::find(sizes.begin(), sizes.end(), 0) != sizes.end()))
+    {
+        throw Pothos::InvalidArgumentException("Throughput sizes must be non-empty and non-zero.");
+    }
+
+    const std::regex regex(kernelRegex);
+
+    Pothos::ObjectVector kernels;
+    for(const auto& kernel: getCharacterizedKernels())
+    {
+        if(!std::regex_search(kernel.name, regex)) continue;
+
+        kernels.emplace_back(characterizeKernel(kernel, sweepPoints, sizes, minSeconds));
+    }
+
+    Pothos::ObjectKwargs report;
+    report["machine"] = Pothos::Object(std::string(volk_get_machine()));
+    report["alignment"] = Pothos::Object(volk_get_alignment());
+    report["sweepPoints"] = Pothos::Object(sweepPoints);
+    report["sizes"] = Pothos::Object(sizes);
+    report["kernels"] = Pothos::Object(kernels);
+
+    return report;
+}
+
+pothos_static_block(pothosVOLKRegisterCharacterize)
+{
+    Pothos::PluginRegistry::addCall(
+        "/volk/characterize",
+        &characterizeVOLKKernels);
+}
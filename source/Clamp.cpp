@@ -0,0 +1,151 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "VOLKBlock.hpp"
+
+#include <volk/volk.h>
+
+//
+// Interface
+//
+
+class Clamp: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        Clamp();
+        virtual ~Clamp() = default;
+
+        float lowerBound() const
+        {
+            return _lowerBound;
+        }
+
+        void setLowerBound(float lowerBound)
+        {
+            _lowerBound = lowerBound;
+        }
+
+        float upperBound() const
+        {
+            return _upperBound;
+        }
+
+        void setUpperBound(float upperBound)
+        {
+            _upperBound = upperBound;
+        }
+
+        void work() override;
+
+    private:
+        float _lowerBound;
+        float _upperBound;
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* Clamp::make()
+{
+    return new Clamp();
+}
+
+Clamp::Clamp():
+    VOLKBlock(),
+    _lowerBound(-1.0f),
+    _upperBound(1.0f)
+{
+    this->setupInput(0, "float");
+    this->setupOutput(0, "float");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Clamp, lowerBound));
+    this->registerCall(this, POTHOS_FCN_TUPLE(Clamp, setLowerBound));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Clamp, upperBound));
+    this->registerCall(this, POTHOS_FCN_TUPLE(Clamp, setUpperBound));
+
+    this->_registerSetterLabel(
+        "setLowerBound",
+        [this](const Pothos::Object& value)
+        {
+            this->setLowerBound(value.convert<float>());
+        });
+    this->_registerSetterLabel(
+        "setUpperBound",
+        [this](const Pothos::Object& value)
+        {
+            this->setUpperBound(value.convert<float>());
+        });
+}
+
+void Clamp::work()
+{
+    const auto elems = this->workInfo().minElements;
+    if(0 == elems) return;
+
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    float* outputBuffer = output->buffer();
+    const float* inputBuffer = input->buffer();
+
+    for(size_t offset = 0; offset < elems;)
+    {
+        const auto spanElems = this->_setterLabelSpan(input, offset, elems);
+
+        volk_32f_s32f_x2_clamp_32f(
+            outputBuffer + offset,
+            inputBuffer + offset,
+            _lowerBound,
+            _upperBound,
+            static_cast<unsigned int>(spanElems));
+
+        offset += spanElems;
+    }
+
+    input->consume(elems);
+    output->produce(elems);
+}
+
+/***********************************************************************
+ * |PothosDoc Clamp (VOLK)
+ *
+ * <p>
+ * Limits floating-point numbers to the range [lowerBound,upperBound].
+ * </p>
+ *
+ * <p>
+ * Underlying function: <b>volk_32f_s32f_x2_clamp_32f</b>
+ * </p>
+ *
+ * <p>
+ * The bounds can also be set by input labels with the IDs
+ * <b>setLowerBound</b> and <b>setUpperBound</b>, which take effect at
+ * the labeled sample.
+ * </p>
+ *
+ * |category /Stream/VOLK
+ * |category /VOLK/Stream
+ * |keywords clip limit saturate bound
+ *
+ * |param lowerBound[Lower Bound]
+ * |widget DoubleSpinBox(decimals=3)
+ * |default -1.0
+ * |preview enable
+ *
+ * |param upperBound[Upper Bound]
+ * |widget DoubleSpinBox(decimals=3)
+ * |default 1.0
+ * |preview enable
+ *
+ * |factory /volk/clamp()
+ * |setter setLowerBound(lowerBound)
+ * |setter setUpperBound(upperBound)
+ **********************************************************************/
+static Pothos::BlockRegistry registerClamp(
+    "/volk/clamp",
+    &Clamp::make);
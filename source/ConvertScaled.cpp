@@ -0,0 +1,272 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// Block
+//
+
+template <typename OutType>
+class ClampConvertScaled: public OneToOneScalarParamBlock<float,OutType,float>
+{
+    public:
+        using Class = ClampConvertScaled<OutType>;
+        using Base = OneToOneScalarParamBlock<float,OutType,float>;
+        using Fcn = typename Base::Fcn;
+
+        static Pothos::Block* make(Fcn fcn)
+        {
+            return new Class(fcn);
+        }
+
+        ClampConvertScaled(Fcn fcn):
+            Base(fcn, "scalar", "setScalar"),
+            _clampEnabled(false),
+            _lowerBound(-1.0f),
+            _upperBound(1.0f),
+            _tile(TileElems)
+        {
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, clampEnabled));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setClampEnabled));
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, lowerBound));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setLowerBound));
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, upperBound));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setUpperBound));
+
+            this->_registerSetterLabel(
+                "setLowerBound",
+                [this](const Pothos::Object& value)
+                {
+                    this->setLowerBound(value.convert<float>());
+                });
+            this->_registerSetterLabel(
+                "setUpperBound",
+                [this](const Pothos::Object& value)
+                {
+                    this->setUpperBound(value.convert<float>());
+                });
+        }
+
+        virtual ~ClampConvertScaled() = default;
+
+        bool clampEnabled() const
+        {
+            return _clampEnabled;
+        }
+
+        void setClampEnabled(bool clampEnabled)
+        {
+            _clampEnabled = clampEnabled;
+        }
+
+        float lowerBound() const
+        {
+            return _lowerBound;
+        }
+
+        void setLowerBound(float lowerBound)
+        {
+            _lowerBound = lowerBound;
+        }
+
+        float upperBound() const
+        {
+            return _upperBound;
+        }
+
+        void setUpperBound(float upperBound)
+        {
+            _upperBound = upperBound;
+        }
+
+    protected:
+        void _runKernel(
+            OutType* output,
+            const float* input,
+            size_t elems) override
+        {
+            if(!_clampEnabled)
+            {
+                Base::_runKernel(output, input, elems);
+                return;
+            }
+
+            for(size_t offset = 0; offset < elems; offset += TileElems)
+            {
+                const auto tileElems = static_cast<unsigned int>(std::min(TileElems, elems - offset));
+
+                volk_32f_s32f_x2_clamp_32f(
+                    _tile.data(),
+                    input + offset,
+                    _lowerBound,
+                    _upperBound,
+                    tileElems);
+                this->_fcn(
+                    output + offset,
+                    _tile.data(),
+                    this->_scalar,
+                    tileElems);
+            }
+        }
+
+    private:
+        bool _clampEnabled;
+        float _lowerBound;
+        float _upperBound;
+
+        std::vector<float> _tile;
+};
+
+/***********************************************************************
+ * |PothosDoc Convert (Custom Scalar) (VOLK)
+ *
+ * <p>
+ * Converts all values and applies a given scalar. Whether the scalar is
+ * multiplied or divided depends on the conversion and is listed below.
+ * </p>
+ *
+ * <p>
+ * Supported conversions:
+ * </p>
+ *
+ * <ul>
+ *   <li>
+ *     float32 -> int8 (float32 scalar)
+ *     <ul>
+ *       <li>Underlying function: <b>volk_f32_sf32_convert_8i</b></li>
+ *       <li>Multiplies all inputs by <b>scalar</b>.</li>
+ *       <li>Truncates all scaled values to fit inside an <b>int8</b>.</li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     float32 -> int16 (float32 scalar)
+ *     <ul>
+ *       <li>Underlying function: <b>volk_f32_sf32_convert_16i</b></li>
+ *       <li>Multiplies all inputs by <b>scalar</b>.</li>
+ *       <li>Truncates all scaled values to fit inside an <b>int16</b>.</li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     float32 -> int32 (float32 scalar)
+ *     <ul>
+ *       <li>Underlying function: <b>volk_32i_s32f_convert_f32</b></li>
+ *       <li>Multiplies all inputs by <b>scalar</b>.</li>
+ *       <li>Truncates all scaled values to fit inside an <b>int32</b>.</li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     int8 -> float32 (float32 scalar)
+ *     <ul>
+ *       <li>Underlying function: <b>volk_8i_s32f_convert_f32</b></li>
+ *       <li>Divides all inputs by <b>scalar</b>.</li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     int16 -> float32 (float32 scalar)
+ *     <ul>
+ *       <li>Underlying function: <b>volk_16i_s32f_convert_f32</b></li>
+ *       <li>Divides all inputs by <b>scalar</b>.</li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     int32 -> float32 (float32 scalar)
+ *     <ul>
+ *       <li>Underlying function: <b>volk_32i_s32f_convert_f32</b></li>
+ *       <li>Divides all inputs by <b>scalar</b>.</li>
+ *     </ul>
+ *   </li>
+ * </ul>
+ *
+ * <p>
+ * For float32 inputs, <b>clampEnabled</b> limits each input to
+ * [lowerBound,upperBound] with <b>volk_32f_s32f_x2_clamp_32f</b> before
+ * it is scaled and converted. This is done in cache-sized tiles, so no
+ * full-size intermediate float buffer is needed.
+ * </p>
+ *
+ * |category /Convert/VOLK
+ * |category /VOLK/Convert
+ * |keywords type
+ *
+ * |param inputDType[Data Type In]
+ * |widget DTypeChooser(int8=1,int16=1,int32=1,float32=1)
+ * |default "int32"
+ * |preview disable
+ *
+ * |param outputDType[Data Type Out]
+ * |widget DTypeChooser(int8=1,int16=1,int32=1,float32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param scalar[Scalar] A scalar to apply to each input post-conversion.
+ * |widget DoubleSpinBox(decimals=3)
+ * |default 1.0
+ * |preview enable
+ *
+ * |param clampEnabled[Clamp Enabled]
+ * Only used for float32 inputs.
+ * |widget ToggleSwitch(on="True", off="False")
+ * |default false
+ * |preview valid
+ *
+ * |param lowerBound[Lower Bound]
+ * |widget DoubleSpinBox(decimals=3)
+ * |default -1.0
+ * |preview valid
+ *
+ * |param upperBound[Upper Bound]
+ * |widget DoubleSpinBox(decimals=3)
+ * |default 1.0
+ * |preview valid
+ *
+ * |factory /volk/convert_scaled(inputDType,outputDType)
+ * |setter setScalar(scalar)
+ * |setter setClampEnabled(clampEnabled)
+ * |setter setLowerBound(lowerBound)
+ * |setter setUpperBound(upperBound)
+ **********************************************************************/
+static const std::string VOLKConvertScaledPath = "/volk/convert_scaled";
+
+static Pothos::Block* makeConvertScaled(
+    const Pothos::DType& inDType,
+    const Pothos::DType& outDType)
+{
+#define IfTypesThenConvertScaledBlock(InType,OutType,Fcn) \
+    if(doesDTypeMatch<InType>(inDType) && doesDTypeMatch<OutType>(outDType)) \
+        return OneToOneScalarParamBlock<InType,OutType,float>::make( \
+            Fcn, \
+            "scalar", \
+            "setScalar");
+
+#define IfTypeThenClampConvertScaledBlock(OutType,Fcn) \
+    if(doesDTypeMatch<float>(inDType) && doesDTypeMatch<OutType>(outDType)) \
+        return ClampConvertScaled<OutType>::make(Fcn);
+
+    IfTypeThenClampConvertScaledBlock(int8_t,volk_32f_s32f_convert_8i)
+    IfTypeThenClampConvertScaledBlock(int16_t,volk_32f_s32f_convert_16i)
+    IfTypeThenClampConvertScaledBlock(int32_t,volk_32f_s32f_convert_32i)
+    IfTypesThenConvertScaledBlock(int8_t,float,volk_8i_s32f_convert_32f)
+    IfTypesThenConvertScaledBlock(int16_t,float,volk_16i_s32f_convert_32f)
+    IfTypesThenConvertScaledBlock(int32_t,float,volk_32i_s32f_convert_32f)
+
+    throw InvalidDTypeException(
+        VOLKConvertScaledPath,
+        inDType,
+        outDType);
+}
+
+static Pothos::BlockRegistry registerVOLKConvertScaled(
+    VOLKConvertScaledPath,
+    &makeConvertScaled);
@@ -0,0 +1,347 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+// How many inputs between exact recalculations of the running energy
+static constexpr size_t EnergyResumInterval = 8192;
+
+// Below this, the window is treated as empty to avoid dividing by zero.
+static constexpr float MinEnergy = 1e-20f;
+
+//
+// Interface
+//
+
+class Correlator: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        Correlator();
+        virtual ~Correlator() = default;
+
+        std::vector<std::complex<float>> preamble() const
+        {
+            return _preamble;
+        }
+
+        void setPreamble(const std::vector<std::complex<float>>& preamble);
+
+        float threshold() const
+        {
+            return _threshold;
+        }
+
+        void setThreshold(float threshold);
+
+        std::string labelID() const
+        {
+            return _labelID;
+        }
+
+        void setLabelID(const std::string& labelID)
+        {
+            _labelID = labelID;
+        }
+
+        float lastMetric() const
+        {
+            return _lastMetric;
+        }
+
+        void reset();
+
+        void work() override;
+
+    private:
+        std::vector<std::complex<float>> _preamble;
+        float _preambleEnergy;
+        float _threshold;
+        std::string _labelID;
+        float _lastMetric;
+
+        // The previous preamble length-1 inputs and their power. Each call
+        // appends up to as many new inputs after the history, so windows
+        // that start before the call's inputs can be correlated in one
+        // piece. The rest are correlated in the input buffer itself.
+        std::vector<std::complex<float>> _seam;
+        std::vector<float> _historyPower;
+        float _energy;
+        size_t _sinceResum;
+
+        // Inputs to wait before detecting again, so each preamble is only
+        // reported once
+        size_t _holdoff;
+        unsigned long long _totalElems;
+
+        void _detect(
+            Pothos::OutputPort* output,
+            size_t elem,
+            const std::complex<float>& correlation,
+            float metric);
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* Correlator::make()
+{
+    return new Correlator();
+}
+
+Correlator::Correlator():
+    VOLKBlock(),
+    _preambleEnergy(0.0f),
+    _threshold(0.8f),
+    _labelID("preamble"),
+    _lastMetric(0.0f),
+    _energy(0.0f),
+    _sinceResum(0),
+    _holdoff(0),
+    _totalElems(0)
+{
+    this->setupInput(0, "complex_float32");
+    this->setupOutput(0, "complex_float32", this->uid()); // Unique domain because of buffer forwarding
+    this->setupOutput("detections");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, preamble));
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, setPreamble));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, threshold));
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, setThreshold));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, labelID));
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, setLabelID));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, lastMetric));
+    this->registerProbe("lastMetric");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Correlator, reset));
+
+    // Explicitly call to size the internal buffers.
+    this->setPreamble({{1.0f, 0.0f}});
+}
+
+void Correlator::setPreamble(const std::vector<std::complex<float>>& preamble)
+{
+    if(preamble.empty()) throw Pothos::InvalidArgumentException("Preamble cannot be empty.");
+
+    _preamble = preamble;
+
+    _preambleEnergy = 0.0f;
+    for(const auto& value: _preamble) _preambleEnergy += std::norm(value);
+    if(_preambleEnergy < MinEnergy) throw Pothos::InvalidArgumentException("Preamble cannot be all zeros.");
+
+    this->reset();
+}
+
+void Correlator::setThreshold(float threshold)
+{
+    if((threshold <= 0.0f) || (threshold > 1.0f))
+    {
+        throw Pothos::RangeException("Threshold must be in the range (0,1].");
+    }
+
+    _threshold = threshold;
+}
+
+void Correlator::reset()
+{
+    // Start with a history of zeros.
+    _seam.assign(2 * (_preamble.size() - 1), {0.0f, 0.0f});
+    _historyPower.assign(_preamble.size() - 1, 0.0f);
+    _energy = 0.0f;
+    _sinceResum = 0;
+    _holdoff = 0;
+    _lastMetric = 0.0f;
+}
+
+void Correlator::work()
+{
+    auto input = this->input(0);
+    const auto elems = input->elements();
+    if(0 == elems) return;
+
+    auto output = this->output(0);
+
+    // The stream is passed through by forwarding the input buffer.
+    auto buffer = input->takeBuffer();
+    const std::complex<float>* inputBuffer = buffer;
+
+    const auto preambleLength = _preamble.size();
+    const auto historyLength = preambleLength - 1;
+
+    std::copy(
+        inputBuffer,
+        inputBuffer + std::min(historyLength, elems),
+        _seam.begin() + historyLength);
+
+    // The detection condition |c|/sqrt(Ex*Ep) >= threshold is compared
+    // squared to avoid a square root per input.
+    const float thresholdSquared = _threshold * _threshold;
+    const size_t resumInterval = std::max<size_t>(preambleLength, EnergyResumInterval);
+
+    for(size_t elem = 0; elem < elems; ++elem)
+    {
+        // The window for this input ends at it, and starts in the seam
+        // until the history has been passed.
+        const std::complex<float>* window = (elem < historyLength) ? &_seam[elem] : (inputBuffer + (elem - historyLength));
+
+        float windowEnergy = 0.0f;
+        if(++_sinceResum >= resumInterval)
+        {
+            std::complex<float> selfProduct;
+            volk_32fc_x2_conjugate_dot_prod_32fc(
+                &selfProduct,
+                window,
+                window,
+                static_cast<unsigned int>(preambleLength));
+            windowEnergy = selfProduct.real();
+            _sinceResum = 0;
+        }
+        else windowEnergy = _energy + std::norm(inputBuffer[elem]);
+
+        // Carry the energy of the newest preamble length-1 inputs over
+        // to the next input.
+        const float oldestPower = (elem < historyLength) ? _historyPower[elem] : std::norm(window[0]);
+        _energy = windowEnergy - oldestPower;
+
+        if(_holdoff > 0)
+        {
+            --_holdoff;
+            continue;
+        }
+        if(windowEnergy < MinEnergy) continue;
+
+        std::complex<float> correlation;
+        volk_32fc_x2_conjugate_dot_prod_32fc(
+            &correlation,
+            window,
+            _preamble.data(),
+            static_cast<unsigned int>(preambleLength));
+
+        const auto energyProduct = windowEnergy * _preambleEnergy;
+        if(std::norm(correlation) >= (thresholdSquared * energyProduct))
+        {
+            this->_detect(
+                output,
+                elem,
+                correlation,
+                std::abs(correlation) / std::sqrt(energyProduct));
+        }
+    }
+
+    // Keep the last preamble length-1 inputs for the next call.
+    if(elems >= historyLength)
+    {
+        std::copy(inputBuffer + (elems - historyLength), inputBuffer + elems, _seam.begin());
+    }
+    else std::copy(_seam.begin() + elems, _seam.begin() + elems + historyLength, _seam.begin());
+
+    volk_32fc_magnitude_squared_32f(
+        _historyPower.data(),
+        _seam.data(),
+        static_cast<unsigned int>(historyLength));
+
+    _totalElems += elems;
+
+    input->consume(elems);
+    output->postBuffer(std::move(buffer));
+}
+
+// Label the last input of the preamble and post its details, including
+// the absolute index of its first input.
+void Correlator::_detect(
+    Pothos::OutputPort* output,
+    size_t elem,
+    const std::complex<float>& correlation,
+    float metric)
+{
+    const auto preambleLength = _preamble.size();
+    const auto endIndex = _totalElems + elem;
+    const auto startIndex = (endIndex >= (preambleLength - 1)) ? (endIndex - (preambleLength - 1)) : 0;
+
+    _lastMetric = metric;
+    _holdoff = preambleLength;
+
+    output->postLabel(Pothos::Label(_labelID, _lastMetric, elem));
+
+    Pothos::Packet packet;
+    packet.metadata["index"] = Pothos::Object(startIndex);
+    packet.metadata["metric"] = Pothos::Object(_lastMetric);
+    packet.metadata["phase"] = Pothos::Object(std::arg(correlation));
+
+    this->output("detections")->postMessage(std::move(packet));
+}
+
+/***********************************************************************
+ * |PothosDoc Correlator (VOLK)
+ *
+ * <p>
+ * Detects a known preamble by sliding it across the input stream, which
+ * is passed through unchanged. For each input, the correlation with the
+ * preamble ending at that input is normalized by the energy of both,
+ * giving a metric in the range [0,1]. The energy of the input window is
+ * updated incrementally for each input.
+ * </p>
+ *
+ * <p>
+ * When the metric reaches the <b>threshold</b>, the block labels the
+ * last input of the preamble with <b>labelID</b>, whose data is the
+ * metric. It also posts a packet on the <b>detections</b> port whose
+ * metadata contains the absolute <b>index</b> of the preamble's first
+ * input, the <b>metric</b>, and the <b>phase</b> of the correlation.
+ * Detection then stops for one preamble length so each preamble is only
+ * reported once.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32fc_x2_conjugate_dot_prod_32fc</b></li>
+ * <li><b>volk_32fc_magnitude_squared_32f</b></li>
+ * </ul>
+ *
+ * |category /Digital/VOLK
+ * |category /VOLK/Digital
+ * |keywords preamble sync burst detect correlate
+ *
+ * |param preamble[Preamble]
+ * The known complex symbols to detect.
+ * |widget LineEdit()
+ * |default [1.0]
+ * |preview enable
+ *
+ * |param threshold[Threshold]
+ * The normalized correlation needed for a detection.
+ * |widget DoubleSpinBox(minimum=0,maximum=1,step=0.01,decimals=3)
+ * |default 0.8
+ * |preview enable
+ *
+ * |param labelID[Label ID]
+ * |widget StringEntry()
+ * |default "preamble"
+ * |preview valid
+ *
+ * |factory /volk/correlator()
+ * |setter setPreamble(preamble)
+ * |setter setThreshold(threshold)
+ * |setter setLabelID(labelID)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKCorrelator(
+    "/volk/correlator",
+    &Correlator::make);
@@ -0,0 +1,195 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <complex>
+#include <string>
+
+//
+// Fused functions
+//
+
+// VOLK has no fused multiply-add kernels, so each product is written
+// to the output and the addend is added in place while the output tile
+// is still in the L1 cache.
+
+static void multiply_add_32f(
+    float* output,
+    const float* input0,
+    const float* input1,
+    const float* input2,
+    unsigned int num_points)
+{
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+
+        volk_32f_x2_multiply_32f(output + offset, input0 + offset, input1 + offset, tileElems);
+        volk_32f_x2_add_32f(output + offset, output + offset, input2 + offset, tileElems);
+    }
+}
+
+static void multiply_add_32fc(
+    std::complex<float>* output,
+    const std::complex<float>* input0,
+    const std::complex<float>* input1,
+    const std::complex<float>* input2,
+    unsigned int num_points)
+{
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+
+        volk_32fc_x2_multiply_32fc(output + offset, input0 + offset, input1 + offset, tileElems);
+        volk_32fc_x2_add_32fc(output + offset, output + offset, input2 + offset, tileElems);
+    }
+}
+
+static void multiply_add_s32f(
+    float* output,
+    const float* input0,
+    const float* input1,
+    const float scalar,
+    unsigned int num_points)
+{
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+
+        volk_32f_x2_multiply_32f(output + offset, input0 + offset, input1 + offset, tileElems);
+        volk_32f_s32f_add_32f(output + offset, output + offset, scalar, tileElems);
+    }
+}
+
+// VOLK has no complex scalar add kernel either, so it's a plain loop
+// the compiler can vectorize.
+static void multiply_add_s32fc(
+    std::complex<float>* output,
+    const std::complex<float>* input0,
+    const std::complex<float>* input1,
+    const std::complex<float> scalar,
+    unsigned int num_points)
+{
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+        std::complex<float>* outputTile = output + offset;
+
+        volk_32fc_x2_multiply_32fc(outputTile, input0 + offset, input1 + offset, tileElems);
+        for(unsigned int elem = 0; elem < tileElems; ++elem) outputTile[elem] += scalar;
+    }
+}
+
+/***********************************************************************
+ * |PothosDoc Multiply Add (VOLK)
+ *
+ * <p>
+ * Outputs <b>in0 * in1 + in2</b> for each set of inputs.
+ * </p>
+ *
+ * <p>
+ * The multiply and add are fused in cache-sized tiles, so no full-size
+ * intermediate buffer is needed between them.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_multiply_32f</b></li>
+ * <li><b>volk_32f_x2_add_32f</b></li>
+ * <li><b>volk_32fc_x2_multiply_32fc</b></li>
+ * <li><b>volk_32fc_x2_add_32fc</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math arithmetic multiply add fma
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float32=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |factory /volk/fma(dtype)
+ **********************************************************************/
+static const std::string VOLKFMAPath = "/volk/fma";
+
+static Pothos::Block* makeFMA(const Pothos::DType& dtype)
+{
+    #define IfTypeThenFMA(type,fcn) \
+        if(doesDTypeMatch<type>(dtype)) return ThreeToOneBlock<type,type,type,type,size_t>::make(fcn,0,1,2);
+
+    IfTypeThenFMA(float,multiply_add_32f)
+    IfTypeThenFMA(std::complex<float>,multiply_add_32fc)
+
+    throw InvalidDTypeException(VOLKFMAPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKFMA(
+    VOLKFMAPath,
+    &makeFMA);
+
+/***********************************************************************
+ * |PothosDoc Multiply Add Scalar (VOLK)
+ *
+ * <p>
+ * Outputs <b>in0 * in1 + scalar</b> for each pair of inputs.
+ * </p>
+ *
+ * <p>
+ * The multiply and add are fused in cache-sized tiles, so no full-size
+ * intermediate buffer is needed between them.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_multiply_32f</b></li>
+ * <li><b>volk_32f_s32f_add_32f</b></li>
+ * <li><b>volk_32fc_x2_multiply_32fc</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math arithmetic multiply add fma
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float32=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param scalar[Scalar]
+ * |widget LineEdit()
+ * |default 0.0
+ * |preview enable
+ *
+ * |factory /volk/fma_scalar(dtype)
+ * |setter setScalar(scalar)
+ **********************************************************************/
+static const std::string VOLKFMAScalarPath = "/volk/fma_scalar";
+
+static Pothos::Block* makeFMAScalar(const Pothos::DType& dtype)
+{
+    #define IfTypeThenFMAScalar(type,fcn) \
+        if(doesDTypeMatch<type>(dtype)) \
+            return TwoToOneScalarParamBlock<type,type,type,type,size_t>::make(fcn,"scalar","setScalar",0,1);
+
+    IfTypeThenFMAScalar(float,multiply_add_s32f)
+    IfTypeThenFMAScalar(std::complex<float>,multiply_add_s32fc)
+
+    throw InvalidDTypeException(VOLKFMAScalarPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKFMAScalar(
+    VOLKFMAScalarPath,
+    &makeFMAScalar);
@@ -0,0 +1,59 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "FallbackSIMD.hpp"
+
+#include <immintrin.h>
+
+namespace
+{
+    struct AVX2Traits
+    {
+        using FloatVec = __m256;
+        static constexpr unsigned int FloatWidth = 8;
+
+        static FloatVec loadFloat(const float* ptr) {return _mm256_loadu_ps(ptr);}
+        static void storeFloat(float* ptr, FloatVec vec) {_mm256_storeu_ps(ptr, vec);}
+        static FloatVec setFloat(float value) {return _mm256_set1_ps(value);}
+
+        static FloatVec add(FloatVec a, FloatVec b) {return _mm256_add_ps(a, b);}
+        static FloatVec sub(FloatVec a, FloatVec b) {return _mm256_sub_ps(a, b);}
+        static FloatVec mul(FloatVec a, FloatVec b) {return _mm256_mul_ps(a, b);}
+        static FloatVec min(FloatVec a, FloatVec b) {return _mm256_min_ps(a, b);}
+        static FloatVec max(FloatVec a, FloatVec b) {return _mm256_max_ps(a, b);}
+        static FloatVec floor(FloatVec vec) {return _mm256_floor_ps(vec);}
+
+        static FloatVec pow2n(FloatVec n)
+        {
+            const auto exponent = _mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127));
+            return _mm256_castsi256_ps(_mm256_slli_epi32(exponent, 23));
+        }
+
+        static FloatVec swapPairs(FloatVec vec) {return _mm256_permute_ps(vec, 0xB1);}
+
+        static FloatVec negateOdd(FloatVec vec)
+        {
+            return _mm256_xor_ps(vec, _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+        }
+
+        using Int16Vec = __m256i;
+        static constexpr unsigned int Int16Width = 16;
+
+        static Int16Vec loadInt16(const short* ptr) {return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));}
+        static void storeInt16(short* ptr, Int16Vec vec) {_mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), vec);}
+
+        static Int16Vec addInt16(Int16Vec a, Int16Vec b) {return _mm256_add_epi16(a, b);}
+
+        static Int16Vec maxStar(Int16Vec a, Int16Vec b)
+        {
+            const auto mask = _mm256_cmpgt_epi16(_mm256_sub_epi16(a, b), _mm256_setzero_si256());
+            return _mm256_blendv_epi8(b, a, mask);
+        }
+    };
+}
+
+const Fallback::KernelTable& Fallback::getAVX2KernelTable()
+{
+    static const KernelTable table = SIMD::makeKernelTable<AVX2Traits>();
+    return table;
+}
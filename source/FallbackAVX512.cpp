@@ -0,0 +1,67 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "FallbackSIMD.hpp"
+
+#include <immintrin.h>
+
+// Requires AVX-512F and AVX-512BW, for the int16 kernels.
+
+namespace
+{
+    struct AVX512Traits
+    {
+        using FloatVec = __m512;
+        static constexpr unsigned int FloatWidth = 16;
+
+        static FloatVec loadFloat(const float* ptr) {return _mm512_loadu_ps(ptr);}
+        static void storeFloat(float* ptr, FloatVec vec) {_mm512_storeu_ps(ptr, vec);}
+        static FloatVec setFloat(float value) {return _mm512_set1_ps(value);}
+
+        static FloatVec add(FloatVec a, FloatVec b) {return _mm512_add_ps(a, b);}
+        static FloatVec sub(FloatVec a, FloatVec b) {return _mm512_sub_ps(a, b);}
+        static FloatVec mul(FloatVec a, FloatVec b) {return _mm512_mul_ps(a, b);}
+        static FloatVec min(FloatVec a, FloatVec b) {return _mm512_min_ps(a, b);}
+        static FloatVec max(FloatVec a, FloatVec b) {return _mm512_max_ps(a, b);}
+
+        static FloatVec floor(FloatVec vec)
+        {
+            return _mm512_roundscale_ps(vec, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        static FloatVec pow2n(FloatVec n)
+        {
+            const auto exponent = _mm512_add_epi32(_mm512_cvttps_epi32(n), _mm512_set1_epi32(127));
+            return _mm512_castsi512_ps(_mm512_slli_epi32(exponent, 23));
+        }
+
+        static FloatVec swapPairs(FloatVec vec) {return _mm512_permute_ps(vec, 0xB1);}
+
+        // _mm512_xor_ps needs AVX-512DQ, so flip the sign bits as integers.
+        static FloatVec negateOdd(FloatVec vec)
+        {
+            const auto signs = _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ULL));
+            return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(vec), signs));
+        }
+
+        using Int16Vec = __m512i;
+        static constexpr unsigned int Int16Width = 32;
+
+        static Int16Vec loadInt16(const short* ptr) {return _mm512_loadu_si512(ptr);}
+        static void storeInt16(short* ptr, Int16Vec vec) {_mm512_storeu_si512(ptr, vec);}
+
+        static Int16Vec addInt16(Int16Vec a, Int16Vec b) {return _mm512_add_epi16(a, b);}
+
+        static Int16Vec maxStar(Int16Vec a, Int16Vec b)
+        {
+            const auto mask = _mm512_cmpgt_epi16_mask(_mm512_sub_epi16(a, b), _mm512_setzero_si512());
+            return _mm512_mask_blend_epi16(mask, b, a);
+        }
+    };
+}
+
+const Fallback::KernelTable& Fallback::getAVX512KernelTable()
+{
+    static const KernelTable table = SIMD::makeKernelTable<AVX512Traits>();
+    return table;
+}
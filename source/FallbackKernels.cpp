@@ -0,0 +1,306 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "FallbackKernels.hpp"
+
+#include <cmath>
+
+//
+// Generic implementations
+//
+
+void Fallback::Generic::volk_32fc_accumulator_s32fc(lv_32fc_t* result,
+                                                    const lv_32fc_t* inputBuffer,
+                                                    unsigned int num_points)
+{
+    const lv_32fc_t* aPtr = inputBuffer;
+    unsigned int number = 0;
+    lv_32fc_t returnValue = lv_cmake(0.f, 0.f);
+
+    for (; number < num_points; number++) {
+        returnValue += (*aPtr++);
+    }
+    *result = returnValue;
+}
+
+void Fallback::Generic::volk_32f_s32f_add_32f(float* cVector,
+                                              const float* aVector,
+                                              const float scalar,
+                                              unsigned int num_points)
+{
+    unsigned int number = 0;
+    const float* inputPtr = aVector;
+    float* outputPtr = cVector;
+    for (number = 0; number < num_points; number++) {
+        *outputPtr = (*inputPtr) + scalar;
+        inputPtr++;
+        outputPtr++;
+    }
+}
+
+void Fallback::Generic::volk_32f_exp_32f(float* bVector,
+                                         const float* aVector,
+                                         unsigned int num_points)
+{
+    float* bPtr = bVector;
+    const float* aPtr = aVector;
+    unsigned int number = 0;
+
+    for (number = 0; number < num_points; number++) {
+        *bPtr++ = expf(*aPtr++);
+    }
+}
+
+void Fallback::Generic::volk_32f_s32f_x2_clamp_32f(float* out,
+                                                   const float* in,
+                                                   const float min,
+                                                   const float max,
+                                                   unsigned int num_points)
+{
+    for (unsigned int number = 0; number < num_points; number++) {
+        if (in[number] < min) {
+            out[number] = min;
+        } else if (in[number] > max) {
+            out[number] = max;
+        } else {
+            out[number] = in[number];
+        }
+    }
+}
+
+void Fallback::Generic::volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+    lv_32fc_t* cVector,
+    const lv_32fc_t* aVector,
+    const lv_32fc_t* bVector,
+    const lv_32fc_t scalar,
+    unsigned int num_points)
+{
+    const lv_32fc_t* aPtr = aVector;
+    const lv_32fc_t* bPtr = bVector;
+    lv_32fc_t* cPtr = cVector;
+    unsigned int number = num_points;
+
+    // unwrap loop
+    while (number >= 8) {
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+        number -= 8;
+    }
+
+    // clean up any remaining
+    while (number-- > 0) {
+        *cPtr++ = (*aPtr++) + lv_conj(*bPtr++) * scalar;
+    }
+}
+
+void Fallback::Generic::volk_16i_max_star_16i(short* target,
+                                              short* src0,
+                                              unsigned int num_points)
+{
+    const unsigned int num_bytes = num_points * 2;
+
+    int i = 0;
+
+    int bound = num_bytes >> 1;
+
+    short candidate = src0[0];
+    for (i = 1; i < bound; ++i) {
+        candidate = ((short)(candidate - src0[i]) > 0) ? candidate : src0[i];
+    }
+    target[0] = candidate;
+}
+
+void Fallback::Generic::volk_16i_x4_quad_max_star_16i(short* target,
+                                                      short* src0,
+                                                      short* src1,
+                                                      short* src2,
+                                                      short* src3,
+                                                      unsigned int num_points)
+{
+    const unsigned int num_bytes = num_points * 2;
+
+    int i = 0;
+
+    int bound = num_bytes >> 1;
+
+    short temp0 = 0;
+    short temp1 = 0;
+    for (i = 0; i < bound; ++i) {
+        temp0 = ((short)(src0[i] - src1[i]) > 0) ? src0[i] : src1[i];
+        temp1 = ((short)(src2[i] - src3[i]) > 0) ? src2[i] : src3[i];
+        target[i] = ((short)(temp0 - temp1) > 0) ? temp0 : temp1;
+    }
+}
+
+void Fallback::Generic::volk_16i_x5_add_quad_16i_x4(short* target0,
+                                                    short* target1,
+                                                    short* target2,
+                                                    short* target3,
+                                                    short* src0,
+                                                    short* src1,
+                                                    short* src2,
+                                                    short* src3,
+                                                    short* src4,
+                                                    unsigned int num_points)
+{
+    const unsigned int num_bytes = num_points * 2;
+
+    int i = 0;
+
+    int bound = num_bytes >> 1;
+
+    for (i = 0; i < bound; ++i) {
+        target0[i] = src0[i] + src1[i];
+        target1[i] = src0[i] + src2[i];
+        target2[i] = src0[i] + src3[i];
+        target3[i] = src0[i] + src4[i];
+    }
+}
+
+const Fallback::KernelTable& Fallback::getGenericKernelTable()
+{
+    static const KernelTable table =
+    {
+        &Generic::volk_32fc_accumulator_s32fc,
+        &Generic::volk_32f_s32f_add_32f,
+        &Generic::volk_32f_exp_32f,
+        &Generic::volk_32f_s32f_x2_clamp_32f,
+        &Generic::volk_32fc_x2_s32fc_multiply_conjugate_add_32fc,
+        &Generic::volk_16i_max_star_16i,
+        &Generic::volk_16i_x4_quad_max_star_16i,
+        &Generic::volk_16i_x5_add_quad_16i_x4,
+    };
+
+    return table;
+}
+
+//
+// Runtime selection
+//
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CPUSupports(feature) __builtin_cpu_supports(feature)
+#else
+#define CPUSupports(feature) false
+#endif
+
+std::vector<std::pair<std::string, Fallback::KernelTable>> Fallback::getSupportedKernelTables()
+{
+    std::vector<std::pair<std::string, KernelTable>> tables;
+    tables.emplace_back("generic", getGenericKernelTable());
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+#endif
+
+#ifdef POTHOSVOLK_FALLBACK_SSE41
+    if(CPUSupports("sse4.1")) tables.emplace_back("sse4_1", getSSE41KernelTable());
+#endif
+#ifdef POTHOSVOLK_FALLBACK_AVX2
+    if(CPUSupports("avx2")) tables.emplace_back("avx2", getAVX2KernelTable());
+#endif
+#ifdef POTHOSVOLK_FALLBACK_AVX512
+    if(CPUSupports("avx512f") && CPUSupports("avx512bw")) tables.emplace_back("avx512", getAVX512KernelTable());
+#endif
+
+    return tables;
+}
+
+// Only checked once, rather than on every call.
+static const Fallback::KernelTable& getFastestKernelTable()
+{
+    static const Fallback::KernelTable table = Fallback::getSupportedKernelTables().back().second;
+    return table;
+}
+
+//
+// Dispatchers
+//
+
+void Fallback::volk_32fc_accumulator_s32fc(
+    lv_32fc_t* result,
+    const lv_32fc_t* inputBuffer,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_32fc_accumulator_s32fc(result, inputBuffer, num_points);
+}
+
+void Fallback::volk_32f_s32f_add_32f(
+    float* cVector,
+    const float* aVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_32f_s32f_add_32f(cVector, aVector, scalar, num_points);
+}
+
+void Fallback::volk_32f_exp_32f(
+    float* bVector,
+    const float* aVector,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_32f_exp_32f(bVector, aVector, num_points);
+}
+
+void Fallback::volk_32f_s32f_x2_clamp_32f(
+    float* out,
+    const float* in,
+    const float min,
+    const float max,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_32f_s32f_x2_clamp_32f(out, in, min, max, num_points);
+}
+
+void Fallback::volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+    lv_32fc_t* cVector,
+    const lv_32fc_t* aVector,
+    const lv_32fc_t* bVector,
+    const lv_32fc_t scalar,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(cVector, aVector, bVector, scalar, num_points);
+}
+
+void Fallback::volk_16i_max_star_16i(
+    short* target,
+    short* src0,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_16i_max_star_16i(target, src0, num_points);
+}
+
+void Fallback::volk_16i_x4_quad_max_star_16i(
+    short* target,
+    short* src0,
+    short* src1,
+    short* src2,
+    short* src3,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_16i_x4_quad_max_star_16i(target, src0, src1, src2, src3, num_points);
+}
+
+void Fallback::volk_16i_x5_add_quad_16i_x4(
+    short* target0,
+    short* target1,
+    short* target2,
+    short* target3,
+    short* src0,
+    short* src1,
+    short* src2,
+    short* src3,
+    short* src4,
+    unsigned int num_points)
+{
+    getFastestKernelTable().volk_16i_x5_add_quad_16i_x4(
+        target0, target1, target2, target3,
+        src0, src1, src2, src3, src4,
+        num_points);
+}
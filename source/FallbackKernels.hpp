@@ -0,0 +1,165 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <volk/volk_complex.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// The module's own implementations of VOLK kernels missing from the
+// installed version of VOLK, as used by Fallback.hpp. These are always
+// built, so the vectorized versions can be tested against the generic
+// ones regardless of the installed VOLK.
+
+namespace Fallback
+{
+    // Copies of VOLK's generic implementations
+    namespace Generic
+    {
+        void volk_32fc_accumulator_s32fc(
+            lv_32fc_t* result,
+            const lv_32fc_t* inputBuffer,
+            unsigned int num_points);
+
+        void volk_32f_s32f_add_32f(
+            float* cVector,
+            const float* aVector,
+            const float scalar,
+            unsigned int num_points);
+
+        void volk_32f_exp_32f(
+            float* bVector,
+            const float* aVector,
+            unsigned int num_points);
+
+        void volk_32f_s32f_x2_clamp_32f(
+            float* out,
+            const float* in,
+            const float min,
+            const float max,
+            unsigned int num_points);
+
+        void volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+            lv_32fc_t* cVector,
+            const lv_32fc_t* aVector,
+            const lv_32fc_t* bVector,
+            const lv_32fc_t scalar,
+            unsigned int num_points);
+
+        void volk_16i_max_star_16i(
+            short* target,
+            short* src0,
+            unsigned int num_points);
+
+        void volk_16i_x4_quad_max_star_16i(
+            short* target,
+            short* src0,
+            short* src1,
+            short* src2,
+            short* src3,
+            unsigned int num_points);
+
+        void volk_16i_x5_add_quad_16i_x4(
+            short* target0,
+            short* target1,
+            short* target2,
+            short* target3,
+            short* src0,
+            short* src1,
+            short* src2,
+            short* src3,
+            short* src4,
+            unsigned int num_points);
+    }
+
+    // One implementation of each kernel
+    struct KernelTable
+    {
+        decltype(&Generic::volk_32fc_accumulator_s32fc) volk_32fc_accumulator_s32fc;
+        decltype(&Generic::volk_32f_s32f_add_32f) volk_32f_s32f_add_32f;
+        decltype(&Generic::volk_32f_exp_32f) volk_32f_exp_32f;
+        decltype(&Generic::volk_32f_s32f_x2_clamp_32f) volk_32f_s32f_x2_clamp_32f;
+        decltype(&Generic::volk_32fc_x2_s32fc_multiply_conjugate_add_32fc) volk_32fc_x2_s32fc_multiply_conjugate_add_32fc;
+        decltype(&Generic::volk_16i_max_star_16i) volk_16i_max_star_16i;
+        decltype(&Generic::volk_16i_x4_quad_max_star_16i) volk_16i_x4_quad_max_star_16i;
+        decltype(&Generic::volk_16i_x5_add_quad_16i_x4) volk_16i_x5_add_quad_16i_x4;
+    };
+
+    const KernelTable& getGenericKernelTable();
+
+    // Each of these is only built if the compiler supports its
+    // instruction set, and must only be called if the CPU does too.
+#ifdef POTHOSVOLK_FALLBACK_SSE41
+    const KernelTable& getSSE41KernelTable();
+#endif
+#ifdef POTHOSVOLK_FALLBACK_AVX2
+    const KernelTable& getAVX2KernelTable();
+#endif
+#ifdef POTHOSVOLK_FALLBACK_AVX512
+    const KernelTable& getAVX512KernelTable();
+#endif
+
+    // The generic table, followed by each table this build and the CPU
+    // support, from slowest to fastest
+    std::vector<std::pair<std::string, KernelTable>> getSupportedKernelTables();
+
+    // The fastest supported implementation of each kernel
+
+    void volk_32fc_accumulator_s32fc(
+        lv_32fc_t* result,
+        const lv_32fc_t* inputBuffer,
+        unsigned int num_points);
+
+    void volk_32f_s32f_add_32f(
+        float* cVector,
+        const float* aVector,
+        const float scalar,
+        unsigned int num_points);
+
+    void volk_32f_exp_32f(
+        float* bVector,
+        const float* aVector,
+        unsigned int num_points);
+
+    void volk_32f_s32f_x2_clamp_32f(
+        float* out,
+        const float* in,
+        const float min,
+        const float max,
+        unsigned int num_points);
+
+    void volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+        lv_32fc_t* cVector,
+        const lv_32fc_t* aVector,
+        const lv_32fc_t* bVector,
+        const lv_32fc_t scalar,
+        unsigned int num_points);
+
+    void volk_16i_max_star_16i(
+        short* target,
+        short* src0,
+        unsigned int num_points);
+
+    void volk_16i_x4_quad_max_star_16i(
+        short* target,
+        short* src0,
+        short* src1,
+        short* src2,
+        short* src3,
+        unsigned int num_points);
+
+    void volk_16i_x5_add_quad_16i_x4(
+        short* target0,
+        short* target1,
+        short* target2,
+        short* target3,
+        short* src0,
+        short* src1,
+        short* src2,
+        short* src3,
+        short* src4,
+        unsigned int num_points);
+}
@@ -0,0 +1,370 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "FallbackKernels.hpp"
+
+// Vectorized fallback kernels, written once against a set of traits
+// wrapping each instruction set's intrinsics. Only FallbackSSE41.cpp,
+// FallbackAVX2.cpp and FallbackAVX512.cpp include this, each compiled
+// with its own instruction set enabled and with traits in an anonymous
+// namespace.
+//
+// Each of those files must not instantiate any inline function or
+// template with external linkage, as the linker could then pick its
+// copy for code that runs on CPUs without the instruction set. Tails
+// use the generic implementations.
+//
+// The float traits provide:
+//  * FloatVec, FloatWidth
+//  * loadFloat, storeFloat, setFloat
+//  * add, sub, mul, min, max, floor
+//  * pow2n: 2^n for integral n
+//  * swapPairs: swaps each pair of floats
+//  * negateOdd: negates each odd float
+//
+// The int16 traits provide:
+//  * Int16Vec, Int16Width
+//  * loadInt16, storeInt16
+//  * addInt16
+//  * maxStar: a if (short)(a-b) > 0, else b
+
+namespace Fallback { namespace SIMD {
+
+template <typename Traits>
+void volk_32fc_accumulator_s32fc(
+    lv_32fc_t* result,
+    const lv_32fc_t* inputBuffer,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::FloatWidth;
+
+    const float* input = reinterpret_cast<const float*>(inputBuffer);
+    const unsigned int numFloats = num_points * 2;
+
+    // Two independent sums hide the latency of each add.
+    auto sum0 = Traits::setFloat(0.0f);
+    auto sum1 = Traits::setFloat(0.0f);
+
+    unsigned int number = 0;
+    for(; (number + (2 * Width)) <= numFloats; number += (2 * Width))
+    {
+        sum0 = Traits::add(sum0, Traits::loadFloat(input + number));
+        sum1 = Traits::add(sum1, Traits::loadFloat(input + number + Width));
+    }
+    for(; (number + Width) <= numFloats; number += Width)
+    {
+        sum0 = Traits::add(sum0, Traits::loadFloat(input + number));
+    }
+
+    float lanes[Width];
+    Traits::storeFloat(lanes, Traits::add(sum0, sum1));
+
+    // Each even lane is a real part, and each odd lane an imaginary part.
+    float real = 0.0f;
+    float imag = 0.0f;
+    for(unsigned int lane = 0; lane < Width; lane += 2)
+    {
+        real += lanes[lane];
+        imag += lanes[lane+1];
+    }
+    for(; number < numFloats; number += 2)
+    {
+        real += input[number];
+        imag += input[number+1];
+    }
+
+    float* output = reinterpret_cast<float*>(result);
+    output[0] = real;
+    output[1] = imag;
+}
+
+template <typename Traits>
+void volk_32f_s32f_add_32f(
+    float* cVector,
+    const float* aVector,
+    const float scalar,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::FloatWidth;
+
+    const auto scalarVec = Traits::setFloat(scalar);
+
+    unsigned int number = 0;
+    for(; (number + Width) <= num_points; number += Width)
+    {
+        Traits::storeFloat(
+            cVector + number,
+            Traits::add(Traits::loadFloat(aVector + number), scalarVec));
+    }
+
+    Generic::volk_32f_s32f_add_32f(
+        cVector + number,
+        aVector + number,
+        scalar,
+        num_points - number);
+}
+
+// The Cephes expf approximation, as in VOLK's SSE implementation. Inputs
+// are clamped to +/-88.376, so, unlike expf, large inputs don't overflow
+// to infinity or underflow to denormals.
+template <typename Traits>
+void volk_32f_exp_32f(
+    float* bVector,
+    const float* aVector,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::FloatWidth;
+
+    const auto expHi = Traits::setFloat(88.3762626647949f);
+    const auto expLo = Traits::setFloat(-88.3762626647949f);
+    const auto log2e = Traits::setFloat(1.44269504088896341f);
+    const auto half = Traits::setFloat(0.5f);
+    const auto one = Traits::setFloat(1.0f);
+
+    // ln(2), split in two so the range reduction is exact
+    const auto c1 = Traits::setFloat(0.693359375f);
+    const auto c2 = Traits::setFloat(-2.12194440e-4f);
+
+    const auto p0 = Traits::setFloat(1.9875691500E-4f);
+    const auto p1 = Traits::setFloat(1.3981999507E-3f);
+    const auto p2 = Traits::setFloat(8.3334519073E-3f);
+    const auto p3 = Traits::setFloat(4.1665795894E-2f);
+    const auto p4 = Traits::setFloat(1.6666665459E-1f);
+    const auto p5 = Traits::setFloat(5.0000001201E-1f);
+
+    unsigned int number = 0;
+    for(; (number + Width) <= num_points; number += Width)
+    {
+        // max and min return their second argument for NaN inputs, so
+        // this order passes NaNs through.
+        auto x = Traits::min(expHi, Traits::max(expLo, Traits::loadFloat(aVector + number)));
+
+        // exp(x) = 2^n * exp(r), where n = round(x/ln(2))
+        const auto n = Traits::floor(Traits::add(Traits::mul(x, log2e), half));
+        x = Traits::sub(x, Traits::mul(n, c1));
+        x = Traits::sub(x, Traits::mul(n, c2));
+
+        const auto x2 = Traits::mul(x, x);
+
+        auto y = p0;
+        y = Traits::add(Traits::mul(y, x), p1);
+        y = Traits::add(Traits::mul(y, x), p2);
+        y = Traits::add(Traits::mul(y, x), p3);
+        y = Traits::add(Traits::mul(y, x), p4);
+        y = Traits::add(Traits::mul(y, x), p5);
+        y = Traits::add(Traits::add(Traits::mul(y, x2), x), one);
+
+        Traits::storeFloat(bVector + number, Traits::mul(y, Traits::pow2n(n)));
+    }
+
+    Generic::volk_32f_exp_32f(
+        bVector + number,
+        aVector + number,
+        num_points - number);
+}
+
+template <typename Traits>
+void volk_32f_s32f_x2_clamp_32f(
+    float* out,
+    const float* in,
+    const float min,
+    const float max,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::FloatWidth;
+
+    const auto minVec = Traits::setFloat(min);
+    const auto maxVec = Traits::setFloat(max);
+
+    unsigned int number = 0;
+    for(; (number + Width) <= num_points; number += Width)
+    {
+        // As in the generic version, NaN inputs are passed through.
+        Traits::storeFloat(
+            out + number,
+            Traits::min(maxVec, Traits::max(minVec, Traits::loadFloat(in + number))));
+    }
+
+    Generic::volk_32f_s32f_x2_clamp_32f(
+        out + number,
+        in + number,
+        min,
+        max,
+        num_points - number);
+}
+
+template <typename Traits>
+void volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+    lv_32fc_t* cVector,
+    const lv_32fc_t* aVector,
+    const lv_32fc_t* bVector,
+    const lv_32fc_t scalar,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::FloatWidth;
+
+    const float* a = reinterpret_cast<const float*>(aVector);
+    const float* b = reinterpret_cast<const float*>(bVector);
+    float* c = reinterpret_cast<float*>(cVector);
+    const unsigned int numFloats = num_points * 2;
+
+    const float* scalarFloats = reinterpret_cast<const float*>(&scalar);
+    const auto scalarReal = Traits::setFloat(scalarFloats[0]);
+    const auto scalarImag = Traits::setFloat(scalarFloats[1]);
+
+    unsigned int number = 0;
+    for(; (number + Width) <= numFloats; number += Width)
+    {
+        const auto bVec = Traits::loadFloat(b + number);
+
+        // conj(b)*s = (br*sr + bi*si) + i(br*si - bi*sr)
+        const auto bScaledReal = Traits::mul(bVec, scalarReal);
+        const auto bScaledImag = Traits::mul(Traits::swapPairs(bVec), scalarImag);
+        const auto product = Traits::add(bScaledImag, Traits::negateOdd(bScaledReal));
+
+        Traits::storeFloat(
+            c + number,
+            Traits::add(Traits::loadFloat(a + number), product));
+    }
+
+    const unsigned int numDone = number / 2;
+    Generic::volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+        cVector + numDone,
+        aVector + numDone,
+        bVector + numDone,
+        scalar,
+        num_points - numDone);
+}
+
+// As in VOLK's SSSE3 implementation, each lane keeps its own candidate,
+// and the lanes are combined at the end. This matches the generic
+// version unless differences between inputs overflow.
+template <typename Traits>
+void volk_16i_max_star_16i(
+    short* target,
+    short* src0,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::Int16Width;
+
+    if(num_points < Width)
+    {
+        Generic::volk_16i_max_star_16i(target, src0, num_points);
+        return;
+    }
+
+    auto candidates = Traits::loadInt16(src0);
+
+    unsigned int number = Width;
+    for(; (number + Width) <= num_points; number += Width)
+    {
+        candidates = Traits::maxStar(candidates, Traits::loadInt16(src0 + number));
+    }
+
+    short lanes[Width];
+    Traits::storeInt16(lanes, candidates);
+
+    short candidate = lanes[0];
+    for(unsigned int lane = 1; lane < Width; ++lane)
+    {
+        candidate = ((short)(candidate - lanes[lane]) > 0) ? candidate : lanes[lane];
+    }
+    for(; number < num_points; ++number)
+    {
+        candidate = ((short)(candidate - src0[number]) > 0) ? candidate : src0[number];
+    }
+
+    target[0] = candidate;
+}
+
+template <typename Traits>
+void volk_16i_x4_quad_max_star_16i(
+    short* target,
+    short* src0,
+    short* src1,
+    short* src2,
+    short* src3,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::Int16Width;
+
+    unsigned int number = 0;
+    for(; (number + Width) <= num_points; number += Width)
+    {
+        const auto temp0 = Traits::maxStar(
+            Traits::loadInt16(src0 + number),
+            Traits::loadInt16(src1 + number));
+        const auto temp1 = Traits::maxStar(
+            Traits::loadInt16(src2 + number),
+            Traits::loadInt16(src3 + number));
+
+        Traits::storeInt16(target + number, Traits::maxStar(temp0, temp1));
+    }
+
+    Generic::volk_16i_x4_quad_max_star_16i(
+        target + number,
+        src0 + number,
+        src1 + number,
+        src2 + number,
+        src3 + number,
+        num_points - number);
+}
+
+template <typename Traits>
+void volk_16i_x5_add_quad_16i_x4(
+    short* target0,
+    short* target1,
+    short* target2,
+    short* target3,
+    short* src0,
+    short* src1,
+    short* src2,
+    short* src3,
+    short* src4,
+    unsigned int num_points)
+{
+    constexpr unsigned int Width = Traits::Int16Width;
+
+    unsigned int number = 0;
+    for(; (number + Width) <= num_points; number += Width)
+    {
+        const auto src0Vec = Traits::loadInt16(src0 + number);
+
+        Traits::storeInt16(target0 + number, Traits::addInt16(src0Vec, Traits::loadInt16(src1 + number)));
+        Traits::storeInt16(target1 + number, Traits::addInt16(src0Vec, Traits::loadInt16(src2 + number)));
+        Traits::storeInt16(target2 + number, Traits::addInt16(src0Vec, Traits::loadInt16(src3 + number)));
+        Traits::storeInt16(target3 + number, Traits::addInt16(src0Vec, Traits::loadInt16(src4 + number)));
+    }
+
+    Generic::volk_16i_x5_add_quad_16i_x4(
+        target0 + number,
+        target1 + number,
+        target2 + number,
+        target3 + number,
+        src0 + number,
+        src1 + number,
+        src2 + number,
+        src3 + number,
+        src4 + number,
+        num_points - number);
+}
+
+template <typename Traits>
+KernelTable makeKernelTable()
+{
+    return
+    {
+        &volk_32fc_accumulator_s32fc<Traits>,
+        &volk_32f_s32f_add_32f<Traits>,
+        &volk_32f_exp_32f<Traits>,
+        &volk_32f_s32f_x2_clamp_32f<Traits>,
+        &volk_32fc_x2_s32fc_multiply_conjugate_add_32fc<Traits>,
+        &volk_16i_max_star_16i<Traits>,
+        &volk_16i_x4_quad_max_star_16i<Traits>,
+        &volk_16i_x5_add_quad_16i_x4<Traits>,
+    };
+}
+
+}}
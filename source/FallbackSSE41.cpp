@@ -0,0 +1,55 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "FallbackSIMD.hpp"
+
+#include <smmintrin.h>
+
+namespace
+{
+    struct SSE41Traits
+    {
+        using FloatVec = __m128;
+        static constexpr unsigned int FloatWidth = 4;
+
+        static FloatVec loadFloat(const float* ptr) {return _mm_loadu_ps(ptr);}
+        static void storeFloat(float* ptr, FloatVec vec) {_mm_storeu_ps(ptr, vec);}
+        static FloatVec setFloat(float value) {return _mm_set1_ps(value);}
+
+        static FloatVec add(FloatVec a, FloatVec b) {return _mm_add_ps(a, b);}
+        static FloatVec sub(FloatVec a, FloatVec b) {return _mm_sub_ps(a, b);}
+        static FloatVec mul(FloatVec a, FloatVec b) {return _mm_mul_ps(a, b);}
+        static FloatVec min(FloatVec a, FloatVec b) {return _mm_min_ps(a, b);}
+        static FloatVec max(FloatVec a, FloatVec b) {return _mm_max_ps(a, b);}
+        static FloatVec floor(FloatVec vec) {return _mm_floor_ps(vec);}
+
+        static FloatVec pow2n(FloatVec n)
+        {
+            const auto exponent = _mm_add_epi32(_mm_cvttps_epi32(n), _mm_set1_epi32(127));
+            return _mm_castsi128_ps(_mm_slli_epi32(exponent, 23));
+        }
+
+        static FloatVec swapPairs(FloatVec vec) {return _mm_shuffle_ps(vec, vec, 0xB1);}
+        static FloatVec negateOdd(FloatVec vec) {return _mm_xor_ps(vec, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));}
+
+        using Int16Vec = __m128i;
+        static constexpr unsigned int Int16Width = 8;
+
+        static Int16Vec loadInt16(const short* ptr) {return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));}
+        static void storeInt16(short* ptr, Int16Vec vec) {_mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), vec);}
+
+        static Int16Vec addInt16(Int16Vec a, Int16Vec b) {return _mm_add_epi16(a, b);}
+
+        static Int16Vec maxStar(Int16Vec a, Int16Vec b)
+        {
+            const auto mask = _mm_cmpgt_epi16(_mm_sub_epi16(a, b), _mm_setzero_si128());
+            return _mm_blendv_epi8(b, a, mask);
+        }
+    };
+}
+
+const Fallback::KernelTable& Fallback::getSSE41KernelTable()
+{
+    static const KernelTable table = SIMD::makeKernelTable<SSE41Traits>();
+    return table;
+}
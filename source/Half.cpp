@@ -0,0 +1,284 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "HalfBlock.hpp"
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <string>
+
+//
+// Fused functions
+//
+
+// Each tile is computed in float32 by VOLK, then converted while it is
+// still in the L1 cache, so no full-size float32 buffer is needed.
+
+template <Half::ToHalfFcn ToHalf>
+static void multiply_scalar_32f_half(
+    uint16_t* output,
+    const float* input,
+    const float scalar,
+    unsigned int num_points)
+{
+    alignas(64) float tile[TileElems];
+
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+
+        volk_32f_s32f_multiply_32f(tile, input + offset, scalar, tileElems);
+        ToHalf(output + offset, tile, tileElems);
+    }
+}
+
+template <Half::ToHalfFcn ToHalf>
+static void multiply_scalar_32fc_halfc(
+    std::complex<uint16_t>* output,
+    const std::complex<float>* input,
+    const std::complex<float> scalar,
+    unsigned int num_points)
+{
+    alignas(64) std::complex<float> tile[TileElems];
+
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+
+        volk_32fc_s32fc_multiply_32fc(tile, input + offset, scalar, tileElems);
+        ToHalf(
+            reinterpret_cast<uint16_t*>(output + offset),
+            reinterpret_cast<const float*>(tile),
+            tileElems * 2);
+    }
+}
+
+template <Half::ToHalfFcn ToHalf>
+static void magnitude_squared_32fc_half(
+    uint16_t* output,
+    const std::complex<float>* input,
+    unsigned int num_points)
+{
+    alignas(64) float tile[TileElems];
+
+    for(unsigned int offset = 0; offset < num_points; offset += TileElems)
+    {
+        const auto tileElems = std::min<unsigned int>(TileElems, num_points - offset);
+
+        volk_32fc_magnitude_squared_32f(tile, input + offset, tileElems);
+        ToHalf(output + offset, tile, tileElems);
+    }
+}
+
+/***********************************************************************
+ * |PothosDoc Convert Half (VOLK)
+ *
+ * <p>
+ * Converts <b>float32</b> and <b>cfloat32</b> values to and from
+ * <b>float16</b> or <b>bfloat16</b>, rounding to the nearest even value.
+ * Uses F16C or AVX-512 conversions if the CPU supports them.
+ * </p>
+ *
+ * <p>
+ * Pothos has no half-precision types, so half-precision values are
+ * stored as <b>uint16</b>, and complex values as <b>complex_uint16</b>.
+ * The <b>format</b> parameter selects how they are interpreted.
+ * </p>
+ *
+ * <p>
+ * Supported types:
+ * </p>
+ *
+ * <ul>
+ * <li>float32 -> uint16</li>
+ * <li>uint16 -> float32</li>
+ * <li>cfloat32 -> complex_uint16</li>
+ * <li>complex_uint16 -> cfloat32</li>
+ * </ul>
+ *
+ * |category /Convert/VOLK
+ * |category /VOLK/Convert
+ * |keywords type float16 bfloat16 half
+ *
+ * |param inputDType[Data Type In]
+ * |widget DTypeChooser(uint16=1,float32=1,cuint16=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param outputDType[Data Type Out]
+ * |widget DTypeChooser(uint16=1,float32=1,cuint16=1,cfloat32=1)
+ * |default "uint16"
+ * |preview disable
+ *
+ * |param format[Format] The half-precision format of the <b>uint16</b> values.
+ * |widget ComboBox(editable=false)
+ * |default "FLOAT16"
+ * |option [Float16] "FLOAT16"
+ * |option [BFloat16] "BFLOAT16"
+ * |preview enable
+ *
+ * |factory /volk/convert_half(inputDType,outputDType,format)
+ **********************************************************************/
+static const std::string VOLKConvertHalfPath = "/volk/convert_half";
+
+static Pothos::Block* makeConvertHalf(
+    const Pothos::DType& inDType,
+    const Pothos::DType& outDType,
+    const std::string& format)
+{
+    if((format != "FLOAT16") && (format != "BFLOAT16"))
+    {
+        throw Pothos::InvalidArgumentException("Invalid format: " + format);
+    }
+    const bool float16 = (format == "FLOAT16");
+
+#define IfTypesThenConvertHalf(InType,OutType,float16Fcn,bfloat16Fcn) \
+    if(doesDTypeMatch<InType>(inDType) && doesDTypeMatch<OutType>(outDType)) \
+        return OneToOneBlock<InType,OutType>::make(float16 ? (float16Fcn) : (bfloat16Fcn));
+
+    IfTypesThenConvertHalf(
+        float,
+        uint16_t,
+        &volk_32f_convert_half<Half::floatToFloat16>,
+        &volk_32f_convert_half<Half::floatToBFloat16>)
+    IfTypesThenConvertHalf(
+        uint16_t,
+        float,
+        &volk_half_convert_32f<Half::float16ToFloat>,
+        &volk_half_convert_32f<Half::bfloat16ToFloat>)
+    IfTypesThenConvertHalf(
+        std::complex<float>,
+        std::complex<uint16_t>,
+        &volk_32fc_convert_halfc<Half::floatToFloat16>,
+        &volk_32fc_convert_halfc<Half::floatToBFloat16>)
+    IfTypesThenConvertHalf(
+        std::complex<uint16_t>,
+        std::complex<float>,
+        &volk_halfc_convert_32fc<Half::float16ToFloat>,
+        &volk_halfc_convert_32fc<Half::bfloat16ToFloat>)
+
+    throw InvalidDTypeException(
+        VOLKConvertHalfPath,
+        inDType,
+        outDType);
+}
+
+static Pothos::BlockRegistry registerVOLKConvertHalf(
+    VOLKConvertHalfPath,
+    &makeConvertHalf);
+
+/***********************************************************************
+ * |PothosDoc Multiply Scalar To Half (VOLK)
+ *
+ * <p>
+ * Multiplies all inputs by a scalar in <b>float32</b>, then stores the
+ * result as <b>float16</b> or <b>bfloat16</b>. The multiply and conversion
+ * are fused in cache-sized tiles.
+ * </p>
+ *
+ * <p>
+ * Pothos has no half-precision types, so outputs are stored as <b>uint16</b>
+ * for <b>float32</b> inputs and <b>complex_uint16</b> for <b>cfloat32</b>
+ * inputs. <b>/volk/convert_half</b> converts them back.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_s32f_multiply_32f</b></li>
+ * <li><b>volk_32fc_s32fc_multiply_32fc</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math constant float16 bfloat16 half
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float32=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param scalar[Scalar] A constant value multiplied with all inputs.
+ * |widget LineEdit()
+ * |default 1.0
+ * |preview enable
+ *
+ * |param format[Format] The half-precision format of the outputs.
+ * |widget ComboBox(editable=false)
+ * |default "FLOAT16"
+ * |option [Float16] "FLOAT16"
+ * |option [BFloat16] "BFLOAT16"
+ * |preview enable
+ *
+ * |factory /volk/multiply_scalar_to_half(dtype)
+ * |setter setScalar(scalar)
+ * |setter setFormat(format)
+ **********************************************************************/
+static const std::string VOLKMultiplyScalarToHalfPath = "/volk/multiply_scalar_to_half";
+
+static Pothos::Block* makeMultiplyScalarToHalf(const Pothos::DType& dtype)
+{
+#define IfTypesThenMultiplyScalarToHalf(Type,OutType,fcn) \
+    if(doesDTypeMatch<Type>(dtype)) \
+        return HalfFormatBlock<OneToOneScalarParamBlock<Type,OutType,Type>>::make( \
+            &fcn<Half::floatToFloat16>, \
+            &fcn<Half::floatToBFloat16>, \
+            "scalar", \
+            "setScalar");
+
+    IfTypesThenMultiplyScalarToHalf(float,uint16_t,multiply_scalar_32f_half)
+    IfTypesThenMultiplyScalarToHalf(std::complex<float>,std::complex<uint16_t>,multiply_scalar_32fc_halfc)
+
+    throw InvalidDTypeException(
+        VOLKMultiplyScalarToHalfPath,
+        dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKMultiplyScalarToHalf(
+    VOLKMultiplyScalarToHalfPath,
+    &makeMultiplyScalarToHalf);
+
+/***********************************************************************
+ * |PothosDoc Magnitude Squared To Half (VOLK)
+ *
+ * <p>
+ * Computes the squared magnitude of each input in <b>float32</b>, then
+ * stores the result as <b>float16</b> or <b>bfloat16</b>, held as
+ * <b>uint16</b>. The two steps are fused in cache-sized tiles.
+ * </p>
+ *
+ * <p>
+ * Underlying function: <b>volk_32fc_magnitude_squared_32f</b>
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math complex float16 bfloat16 half
+ *
+ * |param format[Format] The half-precision format of the outputs.
+ * |widget ComboBox(editable=false)
+ * |default "FLOAT16"
+ * |option [Float16] "FLOAT16"
+ * |option [BFloat16] "BFLOAT16"
+ * |preview enable
+ *
+ * |factory /volk/magnitude_squared_to_half()
+ * |setter setFormat(format)
+ **********************************************************************/
+static Pothos::Block* makeMagnitudeSquaredToHalf()
+{
+    return HalfFormatBlock<OneToOneBlock<std::complex<float>,uint16_t>>::make(
+        &magnitude_squared_32fc_half<Half::floatToFloat16>,
+        &magnitude_squared_32fc_half<Half::floatToBFloat16>);
+}
+
+static Pothos::BlockRegistry registerVOLKMagnitudeSquaredToHalf(
+    "/volk/magnitude_squared_to_half",
+    &makeMagnitudeSquaredToHalf);
@@ -0,0 +1,90 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "HalfKernels.hpp"
+
+#include <immintrin.h>
+
+// Requires AVX-512F. As in FallbackSIMD.hpp, this file must not
+// instantiate any inline function or template with external linkage,
+// and tails use the generic implementations.
+
+namespace { namespace AVX512
+{
+    constexpr size_t Width = 16;
+
+    void floatToFloat16(uint16_t* output, const float* input, size_t num_points)
+    {
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto half = _mm512_cvtps_ph(_mm512_loadu_ps(input + number), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + number), half);
+        }
+
+        Half::Generic::floatToFloat16(output + number, input + number, num_points - number);
+    }
+
+    void float16ToFloat(float* output, const uint16_t* input, size_t num_points)
+    {
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + number));
+            _mm512_storeu_ps(output + number, _mm512_cvtph_ps(half));
+        }
+
+        Half::Generic::float16ToFloat(output + number, input + number, num_points - number);
+    }
+
+    void floatToBFloat16(uint16_t* output, const float* input, size_t num_points)
+    {
+        const auto absMask = _mm512_set1_epi32(0x7FFFFFFF);
+        const auto infinity = _mm512_set1_epi32(0x7F800000);
+        const auto roundingBias = _mm512_set1_epi32(0x7FFF);
+        const auto one = _mm512_set1_epi32(1);
+        const auto quietBit = _mm512_set1_epi32(0x0040);
+
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto bits = _mm512_castps_si512(_mm512_loadu_ps(input + number));
+
+            // Round to nearest even, but only quiet NaNs.
+            const auto lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+            const auto rounded = _mm512_srli_epi32(_mm512_add_epi32(bits, _mm512_add_epi32(roundingBias, lsb)), 16);
+            const auto quieted = _mm512_or_si512(_mm512_srli_epi32(bits, 16), quietBit);
+            const auto isNaN = _mm512_cmpgt_epi32_mask(_mm512_and_si512(bits, absMask), infinity);
+            const auto result = _mm512_mask_blend_epi32(isNaN, rounded, quieted);
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + number), _mm512_cvtepi32_epi16(result));
+        }
+
+        Half::Generic::floatToBFloat16(output + number, input + number, num_points - number);
+    }
+
+    void bfloat16ToFloat(float* output, const uint16_t* input, size_t num_points)
+    {
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto half = _mm512_cvtepu16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + number)));
+            _mm512_storeu_ps(output + number, _mm512_castsi512_ps(_mm512_slli_epi32(half, 16)));
+        }
+
+        Half::Generic::bfloat16ToFloat(output + number, input + number, num_points - number);
+    }
+}}
+
+const Half::KernelTable& Half::getAVX512KernelTable()
+{
+    static const KernelTable table =
+    {
+        &AVX512::floatToFloat16,
+        &AVX512::float16ToFloat,
+        &AVX512::floatToBFloat16,
+        &AVX512::bfloat16ToFloat,
+    };
+
+    return table;
+}
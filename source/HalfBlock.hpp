@@ -0,0 +1,123 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "HalfKernels.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <complex>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+// Pothos has no half-precision types, so float16 and bfloat16 values
+// are stored as uint16, and complex values as complex_uint16.
+
+//
+// Conversion kernels
+//
+
+template <Half::ToHalfFcn ToHalf>
+void volk_32f_convert_half(
+    uint16_t* output,
+    const float* input,
+    unsigned int num_points)
+{
+    ToHalf(output, input, num_points);
+}
+
+template <Half::FromHalfFcn FromHalf>
+void volk_half_convert_32f(
+    float* output,
+    const uint16_t* input,
+    unsigned int num_points)
+{
+    FromHalf(output, input, num_points);
+}
+
+template <Half::ToHalfFcn ToHalf>
+void volk_32fc_convert_halfc(
+    std::complex<uint16_t>* output,
+    const std::complex<float>* input,
+    unsigned int num_points)
+{
+    ToHalf(
+        reinterpret_cast<uint16_t*>(output),
+        reinterpret_cast<const float*>(input),
+        num_points * 2);
+}
+
+template <Half::FromHalfFcn FromHalf>
+void volk_halfc_convert_32fc(
+    std::complex<float>* output,
+    const std::complex<uint16_t>* input,
+    unsigned int num_points)
+{
+    FromHalf(
+        reinterpret_cast<float*>(output),
+        reinterpret_cast<const uint16_t*>(input),
+        num_points * 2);
+}
+
+//
+// HalfFormatBlock
+//
+
+// Adds "format" and "setFormat" calls to the given block, which swap
+// its kernel between the float16 and bfloat16 versions. The storage
+// dtype is the same for both, so the ports don't change.
+template <typename BaseBlock>
+class HalfFormatBlock: public BaseBlock
+{
+    public:
+        using Class = HalfFormatBlock<BaseBlock>;
+        using Fcn = typename BaseBlock::Fcn;
+
+        template <typename... Args>
+        static Pothos::Block* make(
+            Fcn float16Fcn,
+            Fcn bfloat16Fcn,
+            Args&&... args)
+        {
+            return new Class(float16Fcn, bfloat16Fcn, std::forward<Args>(args)...);
+        }
+
+        template <typename... Args>
+        HalfFormatBlock(
+            Fcn float16Fcn,
+            Fcn bfloat16Fcn,
+            Args&&... args
+        ):
+            BaseBlock(float16Fcn, std::forward<Args>(args)...),
+            _float16Fcn(float16Fcn),
+            _bfloat16Fcn(bfloat16Fcn),
+            _format("FLOAT16")
+        {
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, format));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setFormat));
+        }
+
+        virtual ~HalfFormatBlock() = default;
+
+        std::string format() const
+        {
+            return _format;
+        }
+
+        void setFormat(const std::string& format)
+        {
+            if(format == "FLOAT16")       this->_fcn = _float16Fcn;
+            else if(format == "BFLOAT16") this->_fcn = _bfloat16Fcn;
+            else throw Pothos::InvalidArgumentException("Invalid format: " + format);
+
+            _format = format;
+        }
+
+    private:
+        Fcn _float16Fcn;
+        Fcn _bfloat16Fcn;
+        std::string _format;
+};
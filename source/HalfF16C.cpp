@@ -0,0 +1,92 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "HalfKernels.hpp"
+
+#include <immintrin.h>
+
+// Requires AVX2 and F16C. As in FallbackSIMD.hpp, this file must not
+// instantiate any inline function or template with external linkage,
+// and tails use the generic implementations.
+
+namespace { namespace F16C
+{
+    constexpr size_t Width = 8;
+
+    void floatToFloat16(uint16_t* output, const float* input, size_t num_points)
+    {
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto half = _mm256_cvtps_ph(_mm256_loadu_ps(input + number), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + number), half);
+        }
+
+        Half::Generic::floatToFloat16(output + number, input + number, num_points - number);
+    }
+
+    void float16ToFloat(float* output, const uint16_t* input, size_t num_points)
+    {
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + number));
+            _mm256_storeu_ps(output + number, _mm256_cvtph_ps(half));
+        }
+
+        Half::Generic::float16ToFloat(output + number, input + number, num_points - number);
+    }
+
+    void floatToBFloat16(uint16_t* output, const float* input, size_t num_points)
+    {
+        const auto absMask = _mm256_set1_epi32(0x7FFFFFFF);
+        const auto infinity = _mm256_set1_epi32(0x7F800000);
+        const auto roundingBias = _mm256_set1_epi32(0x7FFF);
+        const auto one = _mm256_set1_epi32(1);
+        const auto quietBit = _mm256_set1_epi32(0x0040);
+
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto bits = _mm256_castps_si256(_mm256_loadu_ps(input + number));
+
+            // Round to nearest even, but only quiet NaNs.
+            const auto lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+            const auto rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, _mm256_add_epi32(roundingBias, lsb)), 16);
+            const auto quieted = _mm256_or_si256(_mm256_srli_epi32(bits, 16), quietBit);
+            const auto isNaN = _mm256_cmpgt_epi32(_mm256_and_si256(bits, absMask), infinity);
+            const auto result = _mm256_blendv_epi8(rounded, quieted, isNaN);
+
+            // Every value fits in 16 bits, so packing doesn't saturate.
+            const auto packed = _mm_packus_epi32(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(output + number), packed);
+        }
+
+        Half::Generic::floatToBFloat16(output + number, input + number, num_points - number);
+    }
+
+    void bfloat16ToFloat(float* output, const uint16_t* input, size_t num_points)
+    {
+        size_t number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto half = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + number)));
+            _mm256_storeu_ps(output + number, _mm256_castsi256_ps(_mm256_slli_epi32(half, 16)));
+        }
+
+        Half::Generic::bfloat16ToFloat(output + number, input + number, num_points - number);
+    }
+}}
+
+const Half::KernelTable& Half::getF16CKernelTable()
+{
+    static const KernelTable table =
+    {
+        &F16C::floatToFloat16,
+        &F16C::float16ToFloat,
+        &F16C::floatToBFloat16,
+        &F16C::bfloat16ToFloat,
+    };
+
+    return table;
+}
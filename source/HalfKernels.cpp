@@ -0,0 +1,183 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "HalfKernels.hpp"
+
+#include <cstring>
+
+//
+// Generic implementations
+//
+
+static inline uint32_t floatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static inline float bitsFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Rounds to nearest even, matching F16C. Values too large for float16
+// become infinity. As in F16C, NaNs are quieted and keep the upper bits
+// of their payload.
+static inline uint16_t floatToFloat16Value(float value)
+{
+    constexpr uint32_t Float32Infinity = 255U << 23;
+    constexpr uint32_t Float16Max = (127U + 16U) << 23;
+    constexpr uint32_t Float16MinNormal = 113U << 23;
+
+    // Adding this float shifts subnormal results into place, rounding
+    // as it does.
+    constexpr uint32_t SubnormalMagic = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+
+    uint32_t bits = floatBits(value);
+    const uint32_t sign = bits & 0x80000000U;
+    bits ^= sign;
+
+    uint16_t output;
+    if(bits >= Float16Max)
+    {
+        output = (bits > Float32Infinity) ? uint16_t(0x7E00 | ((bits >> 13) & 0x3FF)) : 0x7C00;
+    }
+    else if(bits < Float16MinNormal)
+    {
+        const float shifted = bitsFloat(bits) + bitsFloat(SubnormalMagic);
+        output = uint16_t(floatBits(shifted) - SubnormalMagic);
+    }
+    else
+    {
+        const uint32_t mantissaOdd = (bits >> 13) & 1;
+
+        // Rebias the exponent, and round to nearest even.
+        bits += ((15U - 127U) << 23) + 0xFFFU;
+        bits += mantissaOdd;
+        output = uint16_t(bits >> 13);
+    }
+
+    return output | uint16_t(sign >> 16);
+}
+
+// NaNs are quieted and keep their payload, matching F16C.
+static inline float float16ToFloatValue(uint16_t value)
+{
+    // Scaling by this float rebiases the exponent, including subnormals.
+    constexpr uint32_t ExponentMagic = (254U - 15U) << 23;
+    constexpr uint32_t WasInfNaN = (127U + 16U) << 23;
+
+    const float scaled = bitsFloat(uint32_t(value & 0x7FFF) << 13) * bitsFloat(ExponentMagic);
+
+    uint32_t bits = floatBits(scaled);
+    if(scaled >= bitsFloat(WasInfNaN))
+    {
+        bits |= 255U << 23;
+        if(value & 0x3FF) bits |= 0x00400000U;
+    }
+    bits |= uint32_t(value & 0x8000) << 16;
+
+    return bitsFloat(bits);
+}
+
+// bfloat16 is the upper half of a float32, so only the rounding of the
+// lower half needs care.
+static inline uint16_t floatToBFloat16Value(float value)
+{
+    const uint32_t bits = floatBits(value);
+    if((bits & 0x7FFFFFFFU) > 0x7F800000U) return uint16_t((bits >> 16) | 0x0040);
+
+    return uint16_t((bits + 0x7FFFU + ((bits >> 16) & 1)) >> 16);
+}
+
+void Half::Generic::floatToFloat16(uint16_t* output, const float* input, size_t num_points)
+{
+    for(size_t i = 0; i < num_points; ++i) output[i] = floatToFloat16Value(input[i]);
+}
+
+void Half::Generic::float16ToFloat(float* output, const uint16_t* input, size_t num_points)
+{
+    for(size_t i = 0; i < num_points; ++i) output[i] = float16ToFloatValue(input[i]);
+}
+
+void Half::Generic::floatToBFloat16(uint16_t* output, const float* input, size_t num_points)
+{
+    for(size_t i = 0; i < num_points; ++i) output[i] = floatToBFloat16Value(input[i]);
+}
+
+void Half::Generic::bfloat16ToFloat(float* output, const uint16_t* input, size_t num_points)
+{
+    for(size_t i = 0; i < num_points; ++i) output[i] = bitsFloat(uint32_t(input[i]) << 16);
+}
+
+const Half::KernelTable& Half::getGenericKernelTable()
+{
+    static const KernelTable table =
+    {
+        &Generic::floatToFloat16,
+        &Generic::float16ToFloat,
+        &Generic::floatToBFloat16,
+        &Generic::bfloat16ToFloat,
+    };
+
+    return table;
+}
+
+//
+// Runtime selection
+//
+
+std::vector<std::pair<std::string, Half::KernelTable>> Half::getSupportedKernelTables()
+{
+    std::vector<std::pair<std::string, KernelTable>> tables;
+    tables.emplace_back("generic", getGenericKernelTable());
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+    // Every AVX2 CPU also supports F16C, which not all compilers can
+    // check for directly.
+#ifdef POTHOSVOLK_HALF_F16C
+    if(__builtin_cpu_supports("avx2")) tables.emplace_back("f16c", getF16CKernelTable());
+#endif
+#ifdef POTHOSVOLK_HALF_AVX512
+    if(__builtin_cpu_supports("avx512f")) tables.emplace_back("avx512", getAVX512KernelTable());
+#endif
+#endif
+
+    return tables;
+}
+
+// Only checked once, rather than on every call.
+static const Half::KernelTable& getFastestKernelTable()
+{
+    static const Half::KernelTable table = Half::getSupportedKernelTables().back().second;
+    return table;
+}
+
+//
+// Dispatchers
+//
+
+void Half::floatToFloat16(uint16_t* output, const float* input, size_t num_points)
+{
+    getFastestKernelTable().floatToFloat16(output, input, num_points);
+}
+
+void Half::float16ToFloat(float* output, const uint16_t* input, size_t num_points)
+{
+    getFastestKernelTable().float16ToFloat(output, input, num_points);
+}
+
+void Half::floatToBFloat16(uint16_t* output, const float* input, size_t num_points)
+{
+    getFastestKernelTable().floatToBFloat16(output, input, num_points);
+}
+
+void Half::bfloat16ToFloat(float* output, const uint16_t* input, size_t num_points)
+{
+    getFastestKernelTable().bfloat16ToFloat(output, input, num_points);
+}
@@ -0,0 +1,59 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Conversions between float32 and the float16 and bfloat16 storage
+// formats, whose values are stored as uint16. Both round to the
+// nearest even value.
+
+namespace Half
+{
+    using ToHalfFcn = void(*)(uint16_t*, const float*, size_t);
+    using FromHalfFcn = void(*)(float*, const uint16_t*, size_t);
+
+    namespace Generic
+    {
+        void floatToFloat16(uint16_t* output, const float* input, size_t num_points);
+        void float16ToFloat(float* output, const uint16_t* input, size_t num_points);
+        void floatToBFloat16(uint16_t* output, const float* input, size_t num_points);
+        void bfloat16ToFloat(float* output, const uint16_t* input, size_t num_points);
+    }
+
+    // One implementation of each conversion
+    struct KernelTable
+    {
+        ToHalfFcn floatToFloat16;
+        FromHalfFcn float16ToFloat;
+        ToHalfFcn floatToBFloat16;
+        FromHalfFcn bfloat16ToFloat;
+    };
+
+    const KernelTable& getGenericKernelTable();
+
+    // As in FallbackKernels.hpp, each of these is only built if the
+    // compiler supports its instruction set, and must only be called if
+    // the CPU does too.
+#ifdef POTHOSVOLK_HALF_F16C
+    const KernelTable& getF16CKernelTable();
+#endif
+#ifdef POTHOSVOLK_HALF_AVX512
+    const KernelTable& getAVX512KernelTable();
+#endif
+
+    // The generic table, followed by each table this build and the CPU
+    // support, from slowest to fastest
+    std::vector<std::pair<std::string, KernelTable>> getSupportedKernelTables();
+
+    // The fastest supported implementation of each conversion
+    void floatToFloat16(uint16_t* output, const float* input, size_t num_points);
+    void float16ToFloat(float* output, const uint16_t* input, size_t num_points);
+    void floatToBFloat16(uint16_t* output, const float* input, size_t num_points);
+    void bfloat16ToFloat(float* output, const uint16_t* input, size_t num_points);
+}
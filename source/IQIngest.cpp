@@ -0,0 +1,400 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cassert>
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+//
+// Interface
+//
+
+class IQIngest: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make(const std::string& format);
+
+        IQIngest(const std::string& format);
+        virtual ~IQIngest() = default;
+
+        std::string format() const
+        {
+            return _format;
+        }
+
+        float fullScale() const
+        {
+            return _fullScale;
+        }
+
+        void setFullScale(float fullScale);
+
+        bool iqSwap() const
+        {
+            return _iqSwap;
+        }
+
+        void setIQSwap(bool iqSwap)
+        {
+            _iqSwap = iqSwap;
+        }
+
+        bool dcRemoval() const
+        {
+            return _dcRemoval;
+        }
+
+        void setDCRemoval(bool dcRemoval);
+
+        float dcAlpha() const
+        {
+            return _dcAlpha;
+        }
+
+        void setDCAlpha(float dcAlpha);
+
+        std::complex<float> dcOffset() const
+        {
+            return _dcOffset;
+        }
+
+        void work() override;
+
+        void propagateLabels(const Pothos::InputPort* input) override;
+
+    private:
+        std::string _format;
+        float _defaultFullScale;
+        float _fullScale;
+        bool _iqSwap;
+        bool _dcRemoval;
+        float _dcAlpha;
+        std::complex<float> _dcOffset;
+        bool _dcOffsetValid;
+
+        // How many input elements and bytes make up each complex sample
+        size_t _inputElemsPerSample;
+        size_t _bytesPerSample;
+
+        std::vector<int16_t> _unpacked;
+
+        using UnpackFcn = void(IQIngest::*)(float*, const uint8_t*, size_t);
+        UnpackFcn _unpack;
+
+        void _unpackCS8(float* output, const uint8_t* input, size_t numSamples);
+        void _unpackCS12(float* output, const uint8_t* input, size_t numSamples);
+        void _unpackCS16(float* output, const uint8_t* input, size_t numSamples);
+
+        void _postProcess(std::complex<float>* output, size_t numSamples);
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* IQIngest::make(const std::string& format)
+{
+    return new IQIngest(format);
+}
+
+IQIngest::IQIngest(const std::string& format):
+    VOLKBlock(),
+    _format(format),
+    _defaultFullScale(1.0f),
+    _fullScale(1.0f),
+    _iqSwap(false),
+    _dcRemoval(false),
+    _dcAlpha(0.01f),
+    _dcOffset(0.0f, 0.0f),
+    _dcOffsetValid(false),
+    _inputElemsPerSample(1),
+    _bytesPerSample(0),
+    _unpack(nullptr)
+{
+    // Full scale values are the magnitude of the most negative value of
+    // each format, with CS12 samples left-justified into 16 bits.
+    if(_format == "CS8")
+    {
+        this->setupInput(0, "complex_int8");
+        _bytesPerSample = 2;
+        _defaultFullScale = 128.0f;
+        _unpack = &IQIngest::_unpackCS8;
+    }
+    else if(_format == "CS12")
+    {
+        this->setupInput(0, "uint8");
+        _inputElemsPerSample = 3;
+        _bytesPerSample = 3;
+        _defaultFullScale = 32768.0f;
+        _unpack = &IQIngest::_unpackCS12;
+        _unpacked.resize(TileElems * 2);
+
+        this->input(0)->setReserve(_inputElemsPerSample);
+    }
+    else if(_format == "CS16")
+    {
+        this->setupInput(0, "complex_int16");
+        _bytesPerSample = 4;
+        _defaultFullScale = 32768.0f;
+        _unpack = &IQIngest::_unpackCS16;
+    }
+    else throw Pothos::InvalidArgumentException("Invalid format: " + _format);
+
+    this->setupOutput(0, "complex_float32");
+
+    _fullScale = _defaultFullScale;
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, format));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, fullScale));
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, setFullScale));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, iqSwap));
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, setIQSwap));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, dcRemoval));
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, setDCRemoval));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, dcAlpha));
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, setDCAlpha));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(IQIngest, dcOffset));
+    this->registerProbe("dcOffset");
+}
+
+void IQIngest::setFullScale(float fullScale)
+{
+    if(fullScale < 0.0f) throw Pothos::RangeException("Full scale must be non-negative.");
+
+    _fullScale = (0.0f == fullScale) ? _defaultFullScale : fullScale;
+}
+
+void IQIngest::setDCRemoval(bool dcRemoval)
+{
+    _dcRemoval = dcRemoval;
+
+    _dcOffset = {0.0f, 0.0f};
+    _dcOffsetValid = false;
+}
+
+void IQIngest::setDCAlpha(float dcAlpha)
+{
+    if((dcAlpha <= 0.0f) || (dcAlpha > 1.0f))
+    {
+        throw Pothos::RangeException("DC alpha must be in the range (0,1].");
+    }
+
+    _dcAlpha = dcAlpha;
+}
+
+void IQIngest::work()
+{
+    assert(_unpack);
+
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const auto numSamples = std::min(
+        input->elements() / _inputElemsPerSample,
+        output->elements());
+    if(0 == numSamples) return;
+
+    const auto* inputBuffer = input->buffer().as<const uint8_t*>();
+    auto* outputBuffer = output->buffer().as<std::complex<float>*>();
+
+    for(size_t offset = 0; offset < numSamples; offset += TileElems)
+    {
+        const auto tileSamples = std::min(TileElems, numSamples - offset);
+
+        std::mem_fn(_unpack)(
+            this,
+            reinterpret_cast<float*>(outputBuffer + offset),
+            inputBuffer + (offset * _bytesPerSample),
+            tileSamples);
+
+        if(_iqSwap || _dcRemoval) this->_postProcess(outputBuffer + offset, tileSamples);
+    }
+
+    input->consume(numSamples * _inputElemsPerSample);
+    output->produce(numSamples);
+}
+
+void IQIngest::propagateLabels(const Pothos::InputPort* input)
+{
+    auto output = this->output(0);
+    for(const auto& label: input->labels())
+    {
+        output->postLabel(label.toAdjusted(1, _inputElemsPerSample));
+    }
+}
+
+void IQIngest::_unpackCS8(float* output, const uint8_t* input, size_t numSamples)
+{
+    volk_8i_s32f_convert_32f(
+        output,
+        reinterpret_cast<const int8_t*>(input),
+        _fullScale,
+        static_cast<unsigned int>(numSamples * 2));
+}
+
+// Each sample is packed into three bytes, with the 12-bit I and Q
+// values unpacked into the upper bits of an int16.
+void IQIngest::_unpackCS12(float* output, const uint8_t* input, size_t numSamples)
+{
+    auto* unpacked = _unpacked.data();
+    for(size_t sample = 0; sample < numSamples; ++sample)
+    {
+        const uint16_t byte0 = input[0];
+        const uint16_t byte1 = input[1];
+        const uint16_t byte2 = input[2];
+        input += 3;
+
+        *(unpacked++) = int16_t(uint16_t((byte1 << 12) | (byte0 << 4)));
+        *(unpacked++) = int16_t(uint16_t((byte2 << 8) | (byte1 & 0xF0)));
+    }
+
+    volk_16i_s32f_convert_32f(
+        output,
+        _unpacked.data(),
+        _fullScale,
+        static_cast<unsigned int>(numSamples * 2));
+}
+
+void IQIngest::_unpackCS16(float* output, const uint8_t* input, size_t numSamples)
+{
+    volk_16i_s32f_convert_32f(
+        output,
+        reinterpret_cast<const int16_t*>(input),
+        _fullScale,
+        static_cast<unsigned int>(numSamples * 2));
+}
+
+void IQIngest::_postProcess(std::complex<float>* output, size_t numSamples)
+{
+    // Swap first, so the DC offset is measured and removed on the same
+    // I and Q values.
+    if(_iqSwap)
+    {
+        for(size_t sample = 0; sample < numSamples; ++sample)
+        {
+            output[sample] = std::complex<float>(output[sample].imag(), output[sample].real());
+        }
+    }
+
+    if(_dcRemoval)
+    {
+        // Track the DC offset with the mean of each tile, which is
+        // then subtracted from each sample.
+        std::complex<float> tileSum;
+        volk_32fc_accumulator_s32fc(
+            &tileSum,
+            output,
+            static_cast<unsigned int>(numSamples));
+
+        const auto tileMean = tileSum / float(numSamples);
+        if(_dcOffsetValid) _dcOffset += (_dcAlpha * (tileMean - _dcOffset));
+        else
+        {
+            _dcOffset = tileMean;
+            _dcOffsetValid = true;
+        }
+
+        for(size_t sample = 0; sample < numSamples; ++sample) output[sample] -= _dcOffset;
+    }
+}
+
+/***********************************************************************
+ * |PothosDoc IQ Ingest (VOLK)
+ *
+ * <p>
+ * Converts complex integer samples from a radio's wire format to
+ * complex float32, scaling each sample by the format's full scale value.
+ * DC removal and IQ swapping can optionally be applied to each converted
+ * tile while it is still in the cache.
+ * </p>
+ *
+ * <p>
+ * Supported formats:
+ * </p>
+ *
+ * <ul>
+ *   <li>
+ *     <b>CS8</b>: complex int8 input
+ *     <ul>
+ *       <li>Underlying function: <b>volk_8i_s32f_convert_32f</b></li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     <b>CS12</b>: uint8 input, with each sample packed into three bytes
+ *     <ul>
+ *       <li>Underlying function: <b>volk_16i_s32f_convert_32f</b></li>
+ *     </ul>
+ *   </li>
+ *   <li>
+ *     <b>CS16</b>: complex int16 input
+ *     <ul>
+ *       <li>Underlying function: <b>volk_16i_s32f_convert_32f</b></li>
+ *     </ul>
+ *   </li>
+ * </ul>
+ *
+ * <p>
+ * DC removal tracks the mean of each tile with
+ * <b>volk_32fc_accumulator_s32fc</b>.
+ * </p>
+ *
+ * |category /Convert/VOLK
+ * |category /VOLK/Convert
+ * |keywords type sdr radio cs8 cs12 cs16 dc
+ *
+ * |param format[Format]
+ * |widget ComboBox(editable=false)
+ * |default "CS16"
+ * |option [CS8] "CS8"
+ * |option [CS12] "CS12"
+ * |option [CS16] "CS16"
+ * |preview enable
+ *
+ * |param fullScale[Full Scale]
+ * Each input is divided by this value. If <b>0</b>, the format's
+ * maximum magnitude is used.
+ * |widget DoubleSpinBox(minimum=0,decimals=3)
+ * |default 0.0
+ * |preview valid
+ *
+ * |param iqSwap[IQ Swap]
+ * |widget ToggleSwitch(on="True", off="False")
+ * |default false
+ * |preview valid
+ *
+ * |param dcRemoval[DC Removal]
+ * |widget ToggleSwitch(on="True", off="False")
+ * |default false
+ * |preview valid
+ *
+ * |param dcAlpha[DC Alpha]
+ * The weight of each tile's mean in the tracked DC offset.
+ * |widget DoubleSpinBox(minimum=0,maximum=1,step=0.001,decimals=4)
+ * |default 0.01
+ * |preview valid
+ *
+ * |factory /volk/iq_ingest(format)
+ * |setter setFullScale(fullScale)
+ * |setter setIQSwap(iqSwap)
+ * |setter setDCRemoval(dcRemoval)
+ * |setter setDCAlpha(dcAlpha)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKIQIngest(
+    "/volk/iq_ingest",
+    &IQIngest::make);
@@ -0,0 +1,185 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "FallbackKernels.hpp"
+#include "HalfKernels.hpp"
+#include "ModuleKernels.hpp"
+
+#include <Pothos/Object/Containers.hpp>
+#include <Pothos/Plugin.hpp>
+
+#include <volk/volk.h>
+#include <volk/volk_prefs.h>
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+//
+// Implementation selection
+//
+
+class VOLKPreferences
+{
+    public:
+        VOLKPreferences():
+            _prefs(nullptr),
+            _numPrefs(volk_load_preferences(&_prefs))
+        {}
+
+        ~VOLKPreferences()
+        {
+            std::free(_prefs);
+        }
+
+        const volk_arch_pref_t* find(const std::string& kernelName) const
+        {
+            for(size_t i = 0; i < _numPrefs; ++i)
+            {
+                if(kernelName == _prefs[i].name) return &_prefs[i];
+            }
+
+            return nullptr;
+        }
+
+    private:
+        volk_arch_pref_t* _prefs;
+        size_t _numPrefs;
+};
+
+static bool isGenericImpl(const std::string& implName)
+{
+    return (implName.find("generic") != std::string::npos);
+}
+
+// VOLK doesn't expose which implementation it dispatches to, so this
+// repeats its ranking: VOLK_GENERIC forces the generic implementation,
+// then the config file's preference is used if present, and otherwise
+// the implementation with the highest architecture requirements for
+// the alignment. Aligned implementations are only called for aligned
+// buffers.
+static std::string getSelectedImpl(
+    const volk_func_desc_t& desc,
+    const volk_arch_pref_t* pref,
+    bool aligned)
+{
+    if(0 == desc.n_impls) return "";
+
+    std::string preferred;
+    if(std::getenv("VOLK_GENERIC")) preferred = "generic";
+    else if(pref) preferred = aligned ? pref->impl_a : pref->impl_u;
+
+    if(!preferred.empty())
+    {
+        for(size_t i = 0; i < desc.n_impls; ++i)
+        {
+            if(preferred == desc.impl_names[i]) return preferred;
+        }
+    }
+
+    int bestAligned = -1;
+    int bestUnaligned = -1;
+    size_t bestAlignedIndex = 0;
+    size_t bestUnalignedIndex = 0;
+    for(size_t i = 0; i < desc.n_impls; ++i)
+    {
+        if(desc.impl_alignment[i] && (desc.impl_deps[i] > bestAligned))
+        {
+            bestAligned = desc.impl_deps[i];
+            bestAlignedIndex = i;
+        }
+        else if(!desc.impl_alignment[i] && (desc.impl_deps[i] > bestUnaligned))
+        {
+            bestUnaligned = desc.impl_deps[i];
+            bestUnalignedIndex = i;
+        }
+    }
+
+    if(aligned && (bestAligned != -1)) return desc.impl_names[bestAlignedIndex];
+    return desc.impl_names[bestUnalignedIndex];
+}
+
+// Kernels missing from this VOLK version use the module's fallback,
+// whose implementation is the instruction set it was dispatched to.
+static Pothos::ObjectKwargs getKernelInfo(
+    const ModuleKernel& kernel,
+    const VOLKPreferences& prefs,
+    const std::string& fallbackArch)
+{
+    Pothos::ObjectKwargs info;
+    info["name"] = Pothos::Object(std::string(kernel.name));
+    info["fallback"] = Pothos::Object(!kernel.getFuncDesc);
+
+    std::vector<std::string> implNames;
+    std::string selectedAligned = fallbackArch;
+    std::string selectedUnaligned = fallbackArch;
+    bool genericOnly = (fallbackArch == "generic");
+    bool selectedGeneric = genericOnly;
+
+    if(kernel.getFuncDesc)
+    {
+        const auto desc = kernel.getFuncDesc();
+        for(size_t i = 0; i < desc.n_impls; ++i) implNames.emplace_back(desc.impl_names[i]);
+
+        const auto* pref = prefs.find(kernel.name);
+        selectedAligned = getSelectedImpl(desc, pref, true);
+        selectedUnaligned = getSelectedImpl(desc, pref, false);
+
+        genericOnly = true;
+        for(const auto& implName: implNames) genericOnly &= isGenericImpl(implName);
+        selectedGeneric = isGenericImpl(selectedAligned) && isGenericImpl(selectedUnaligned);
+    }
+
+    info["implementations"] = Pothos::Object(implNames);
+    info["selectedAligned"] = Pothos::Object(selectedAligned);
+    info["selectedUnaligned"] = Pothos::Object(selectedUnaligned);
+    info["genericOnly"] = Pothos::Object(genericOnly);
+    info["selectedGeneric"] = Pothos::Object(selectedGeneric);
+
+    return info;
+}
+
+//
+// Plugin
+//
+
+// Returns the host's VOLK machine, alignment, and config path, and for
+// each kernel used by this module, its available implementations and
+// the ones VOLK selects. Kernels missing from this VOLK version, which
+// use the module's own fallback, are marked as such, and fallbackArch
+// is the instruction set those fallbacks use. halfArch is the same for
+// the half-precision conversions.
+static Pothos::ObjectKwargs getVOLKInfo()
+{
+    constexpr size_t VOLKPathSize = 512;
+    char path[VOLKPathSize] = {0};
+    volk_get_config_path(path, true);
+
+    const std::string fallbackArch = Fallback::getSupportedKernelTables().back().first;
+
+    Pothos::ObjectKwargs info;
+    info["machine"] = Pothos::Object(std::string(volk_get_machine()));
+    info["alignment"] = Pothos::Object(volk_get_alignment());
+    info["configPath"] = Pothos::Object(std::string(path));
+    info["fallbackArch"] = Pothos::Object(fallbackArch);
+    info["halfArch"] = Pothos::Object(Half::getSupportedKernelTables().back().first);
+
+    const VOLKPreferences prefs;
+
+    Pothos::ObjectVector kernels;
+    for(const auto& kernel: getModuleKernels())
+    {
+        kernels.emplace_back(getKernelInfo(kernel, prefs, fallbackArch));
+    }
+    info["kernels"] = Pothos::Object(kernels);
+
+    return info;
+}
+
+pothos_static_block(pothosVOLKRegisterInfo)
+{
+    Pothos::PluginRegistry::addCall(
+        "/volk/info",
+        &getVOLKInfo);
+}
@@ -68,6 +68,19 @@ ModRange::ModRange():
 
     this->registerCall(this, POTHOS_FCN_TUPLE(ModRange, upperBound));
     this->registerCall(this, POTHOS_FCN_TUPLE(ModRange, setUpperBound));
+
+    this->_registerSetterLabel(
+        "setLowerBound",
+        [this](const Pothos::Object& value)
+        {
+            this->setLowerBound(value.convert<float>());
+        });
+    this->_registerSetterLabel(
+        "setUpperBound",
+        [this](const Pothos::Object& value)
+        {
+            this->setUpperBound(value.convert<float>());
+        });
 }
 
 void ModRange::work()
@@ -78,12 +91,22 @@ void ModRange::work()
     auto input = this->input(0);
     auto output = this->output(0);
 
-    volk_32f_s32f_s32f_mod_range_32f(
-        output->buffer(),
-        input->buffer(),
-        _lowerBound,
-        _upperBound,
-        static_cast<unsigned int>(elems));
+    float* outputBuffer = output->buffer();
+    const float* inputBuffer = input->buffer();
+
+    for(size_t offset = 0; offset < elems;)
+    {
+        const auto spanElems = this->_setterLabelSpan(input, offset, elems);
+
+        volk_32f_s32f_s32f_mod_range_32f(
+            outputBuffer + offset,
+            inputBuffer + offset,
+            _lowerBound,
+            _upperBound,
+            static_cast<unsigned int>(spanElems));
+
+        offset += spanElems;
+    }
 
     input->consume(elems);
     output->produce(elems);
@@ -100,6 +123,12 @@ void ModRange::work()
  * Underlying function: <b>volk_32f_s32f_s32f_mod_range_32f</b>
  * </p>
  *
+ * <p>
+ * The bounds can also be set by input labels with the IDs
+ * <b>setLowerBound</b> and <b>setUpperBound</b>, which take effect at
+ * the labeled sample.
+ * </p>
+ *
  * |category /Stream/VOLK
  * |category /VOLK/Stream
  * |keywords clamp bound wrap
@@ -1,20 +1,210 @@
-// Copyright 2021 Nicholas Corgan
+// Copyright 2021,2023 Nicholas Corgan
 // SPDX-License-Identifier: GPL-3.0-or-later
 
+#include "ModuleKernels.hpp"
+
 #include <Pothos/Plugin.hpp>
 
+#include <Poco/Environment.h>
+#include <Poco/Exception.h>
+#include <Poco/File.h>
+#include <Poco/Format.h>
 #include <Poco/Logger.h>
+#include <Poco/Path.h>
+#include <Poco/Process.h>
 
 #include <volk/volk_prefs.h>
 
+#include <fstream>
+#include <map>
+#include <string>
+#include <thread>
+
+// Set to any value to profile this module's kernels when no VOLK config
+// is found.
+static const std::string AutoProfileEnvVar = "POTHOS_VOLK_AUTO_PROFILE";
+
+static constexpr size_t VOLKPathSize = 512;
+
+// VOLK tests these kernels through wrappers ("puppets") with a
+// testable signature, and volk_profile matches the tests' names, so the
+// puppets are what must be profiled.
+static const std::map<std::string, std::string> PuppetNames =
+{
+    {"volk_16u_byteswap", "volk_16u_byteswappuppet_16u"},
+    {"volk_32u_byteswap", "volk_32u_byteswappuppet_32u"},
+    {"volk_64u_byteswap", "volk_64u_byteswappuppet_64u"},
+    {"volk_64u_popcnt", "volk_64u_popcntpuppet_64u"},
+    {"volk_32f_s32f_x2_clamp_32f", "volk_32f_s32f_x2_clamppuppet_32f"},
+    {"volk_32f_s32f_s32f_mod_range_32f", "volk_32f_s32f_mod_rangepuppet_32f"},
+};
+
+// volk_profile only runs the kernels matching this, rather than every
+// kernel VOLK provides.
+static std::string getModuleKernelRegex()
+{
+    std::string regex;
+    for(const auto& kernel: getModuleKernels())
+    {
+        // Fallbacks aren't VOLK kernels, so there's nothing to profile.
+        if(!kernel.getFuncDesc) continue;
+
+        const auto puppetIter = PuppetNames.find(kernel.name);
+
+        if(!regex.empty()) regex += "|";
+        regex += (puppetIter != PuppetNames.end()) ? puppetIter->second : kernel.name;
+    }
+
+    return "^(" + regex + ")$";
+}
+
+// Every process that loads this module without a config would otherwise
+// start its own volk_profile, each writing the same file. Only the
+// process that creates this lock file next to the config profiles, and
+// it removes the file when done. The file holds the PID of the profiling
+// process, so a lock left behind by one that died is taken over.
+class ProfileLock
+{
+    public:
+        explicit ProfileLock(const std::string& configPath):
+            _file(configPath + ".lock"),
+            _locked(false)
+        {
+            Poco::File(Poco::Path(_file.path()).parent()).createDirectories();
+
+            _locked = _file.createFile();
+            if(!_locked && this->_isStale())
+            {
+                _file.remove();
+                _locked = _file.createFile();
+            }
+            if(_locked) this->setOwner(Poco::Process::id());
+        }
+
+        ~ProfileLock()
+        {
+            if(!_locked) return;
+
+            try {_file.remove();}
+            catch(const Poco::Exception&) {}
+        }
+
+        ProfileLock(const ProfileLock&) = delete;
+        ProfileLock& operator=(const ProfileLock&) = delete;
+
+        bool locked() const
+        {
+            return _locked;
+        }
+
+        const std::string& path() const
+        {
+            return _file.path();
+        }
+
+        void setOwner(Poco::Process::PID pid) const
+        {
+            std::ofstream(_file.path(), std::ios::trunc) << pid;
+        }
+
+    private:
+        Poco::File _file;
+        bool _locked;
+
+        // A lock without a PID was just created by another process that
+        // hasn't written it yet, so it isn't stale.
+        bool _isStale() const
+        {
+            Poco::Process::PID pid = 0;
+            std::ifstream(_file.path()) >> pid;
+
+            return (pid > 0) && !Poco::Process::isRunning(pid);
+        }
+};
+
+// volk_profile's output goes to a log file next to the config rather
+// than to a pipe this process reads, so profiling finishes even if this
+// process exits first.
+static Poco::ProcessHandle launchVOLKProfile(const std::string& logPath)
+{
+#ifdef _WIN32
+    (void)logPath;
+    const Poco::Process::Args args{"--tests-regex", getModuleKernelRegex()};
+
+    return Poco::Process::launch("volk_profile", args);
+#else
+    // exec, so the PID recorded in the lock is volk_profile's.
+    const Poco::Process::Args args{
+        "-c",
+        "exec volk_profile --tests-regex \"$1\" > \"$2\" 2>&1",
+        "sh",
+        getModuleKernelRegex(),
+        logPath};
+
+    return Poco::Process::launch("/bin/sh", args);
+#endif
+}
+
+// volk_profile writes its results to the VOLK config path, so only
+// processes started after it finishes use the tuned implementations.
+static void profileModuleKernels()
+{
+    auto& logger = Poco::Logger::get("PothosVOLK");
+
+    try
+    {
+        char configPath[VOLKPathSize] = {0};
+        volk_get_config_path(configPath, false);
+
+        const ProfileLock lock(configPath);
+        if(!lock.locked())
+        {
+            logger.information(
+                "Another process is already profiling this module's VOLK kernels. "
+                "If not, remove " + lock.path() + ".");
+            return;
+        }
+
+        // Another process may have finished profiling before this one
+        // took the lock.
+        if(Poco::File(configPath).exists()) return;
+
+        const std::string logPath = std::string(configPath) + ".profile.log";
+        auto handle = launchVOLKProfile(logPath);
+        lock.setOwner(handle.id());
+
+        logger.information(Poco::format(
+            "Profiling this module's VOLK kernels in the background (PID %d, log %s).",
+            static_cast<int>(handle.id()),
+            logPath));
+
+        const int ret = handle.wait();
+        if(0 == ret) logger.information("VOLK profiling complete. New processes will use the results.");
+        else logger.warning(Poco::format("volk_profile failed with exit code %d. See %s.", ret, logPath));
+    }
+    catch(const Poco::Exception& ex)
+    {
+        logger.warning("Failed to run volk_profile: " + ex.displayText());
+    }
+}
+
 pothos_static_block(pothosVOLKCheckVOLKConfig)
 {
-    constexpr size_t VOLKPathSize = 512;
     char path[VOLKPathSize] = {0};
 
     volk_get_config_path(path, true);
     if(path[0] == 0)
     {
-        Poco::Logger::get("PothosVOLK").warning("No VOLK config file found. Run volk_profile for best performance.");
+        if(Poco::Environment::has(AutoProfileEnvVar))
+        {
+            // Profiling takes a while, so don't block loading the module.
+            std::thread(&profileModuleKernels).detach();
+        }
+        else
+        {
+            Poco::Logger::get("PothosVOLK").warning(
+                "No VOLK config file found. Run volk_profile for best performance, "
+                "or set " + AutoProfileEnvVar + " to profile this module's kernels.");
+        }
     }
 }
@@ -0,0 +1,146 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ModuleKernels.hpp"
+
+#define VOLKKernel(kernel) {#kernel, &kernel##_get_func_desc}
+#define FallbackKernel(kernel) {#kernel, nullptr}
+
+const std::vector<ModuleKernel>& getModuleKernels()
+{
+    static const std::vector<ModuleKernel> ModuleKernels =
+    {
+        VOLKKernel(volk_16i_convert_8i),
+#ifdef HAVE_16I_MAX_STAR
+        VOLKKernel(volk_16i_max_star_16i),
+#else
+        FallbackKernel(volk_16i_max_star_16i),
+#endif
+        VOLKKernel(volk_16i_max_star_horizontal_16i),
+        VOLKKernel(volk_16i_s32f_convert_32f),
+#ifdef HAVE_16I_X4_QUAD_MAX_STAR
+        VOLKKernel(volk_16i_x4_quad_max_star_16i),
+#else
+        FallbackKernel(volk_16i_x4_quad_max_star_16i),
+#endif
+#ifdef HAVE_16I_X5_ADD_QUAD
+        VOLKKernel(volk_16i_x5_add_quad_16i_x4),
+#else
+        FallbackKernel(volk_16i_x5_add_quad_16i_x4),
+#endif
+        VOLKKernel(volk_16ic_convert_32fc),
+        VOLKKernel(volk_16ic_deinterleave_16i_x2),
+        VOLKKernel(volk_16ic_deinterleave_real_16i),
+        VOLKKernel(volk_16ic_deinterleave_real_8i),
+        VOLKKernel(volk_16ic_magnitude_16i),
+        VOLKKernel(volk_16ic_s32f_deinterleave_32f_x2),
+        VOLKKernel(volk_16ic_s32f_deinterleave_real_32f),
+        VOLKKernel(volk_16ic_x2_multiply_16ic),
+        VOLKKernel(volk_16u_byteswap),
+        VOLKKernel(volk_32f_64f_add_64f),
+        VOLKKernel(volk_32f_64f_multiply_64f),
+        VOLKKernel(volk_32f_accumulator_s32f),
+        VOLKKernel(volk_32f_acos_32f),
+        VOLKKernel(volk_32f_asin_32f),
+        VOLKKernel(volk_32f_atan_32f),
+        VOLKKernel(volk_32f_binary_slicer_8i),
+        VOLKKernel(volk_32f_convert_64f),
+        VOLKKernel(volk_32f_cos_32f),
+#ifdef HAVE_32F_EXP
+        VOLKKernel(volk_32f_exp_32f),
+#else
+        FallbackKernel(volk_32f_exp_32f),
+#endif
+        VOLKKernel(volk_32f_expfast_32f),
+        VOLKKernel(volk_32f_invsqrt_32f),
+        VOLKKernel(volk_32f_log2_32f),
+#ifdef HAVE_32F_S32F_ADD
+        VOLKKernel(volk_32f_s32f_add_32f),
+#else
+        FallbackKernel(volk_32f_s32f_add_32f),
+#endif
+        VOLKKernel(volk_32f_s32f_calc_spectral_noise_floor_32f),
+        VOLKKernel(volk_32f_s32f_convert_16i),
+        VOLKKernel(volk_32f_s32f_convert_32i),
+        VOLKKernel(volk_32f_s32f_convert_8i),
+        VOLKKernel(volk_32f_s32f_multiply_32f),
+        VOLKKernel(volk_32f_s32f_normalize),
+        VOLKKernel(volk_32f_s32f_power_32f),
+        VOLKKernel(volk_32f_s32f_s32f_mod_range_32f),
+#ifdef HAVE_32F_S32F_X2_CLAMP
+        VOLKKernel(volk_32f_s32f_x2_clamp_32f),
+#else
+        FallbackKernel(volk_32f_s32f_x2_clamp_32f),
+#endif
+        VOLKKernel(volk_32f_sin_32f),
+        VOLKKernel(volk_32f_sqrt_32f),
+        VOLKKernel(volk_32f_tan_32f),
+        VOLKKernel(volk_32f_tanh_32f),
+        VOLKKernel(volk_32f_x2_add_32f),
+        VOLKKernel(volk_32f_x2_divide_32f),
+        VOLKKernel(volk_32f_x2_interleave_32fc),
+        VOLKKernel(volk_32f_x2_max_32f),
+        VOLKKernel(volk_32f_x2_min_32f),
+        VOLKKernel(volk_32f_x2_multiply_32f),
+        VOLKKernel(volk_32f_x2_pow_32f),
+        VOLKKernel(volk_32f_x2_s32f_interleave_16ic),
+        VOLKKernel(volk_32f_x2_subtract_32f),
+        VOLKKernel(volk_32f_x3_sum_of_poly_32f),
+        VOLKKernel(volk_32fc_32f_add_32fc),
+        VOLKKernel(volk_32fc_32f_multiply_32fc),
+#ifdef HAVE_32FC_ACCUMULATOR
+        VOLKKernel(volk_32fc_accumulator_s32fc),
+#else
+        FallbackKernel(volk_32fc_accumulator_s32fc),
+#endif
+        VOLKKernel(volk_32fc_conjugate_32fc),
+        VOLKKernel(volk_32fc_convert_16ic),
+        VOLKKernel(volk_32fc_deinterleave_32f_x2),
+        VOLKKernel(volk_32fc_deinterleave_64f_x2),
+        VOLKKernel(volk_32fc_deinterleave_imag_32f),
+        VOLKKernel(volk_32fc_deinterleave_real_32f),
+        VOLKKernel(volk_32fc_deinterleave_real_64f),
+        VOLKKernel(volk_32fc_magnitude_32f),
+        VOLKKernel(volk_32fc_magnitude_squared_32f),
+        VOLKKernel(volk_32fc_s32f_atan2_32f),
+        VOLKKernel(volk_32fc_s32f_deinterleave_real_16i),
+        VOLKKernel(volk_32fc_s32f_power_spectrum_32f),
+        VOLKKernel(volk_32fc_s32f_x2_power_spectral_density_32f),
+        VOLKKernel(volk_32fc_s32fc_multiply_32fc),
+        VOLKKernel(volk_32fc_x2_add_32fc),
+        VOLKKernel(volk_32fc_x2_conjugate_dot_prod_32fc),
+        VOLKKernel(volk_32fc_x2_divide_32fc),
+        VOLKKernel(volk_32fc_x2_multiply_32fc),
+        VOLKKernel(volk_32fc_x2_multiply_conjugate_32fc),
+        VOLKKernel(volk_32fc_x2_s32f_square_dist_scalar_mult_32f),
+#ifdef HAVE_32FC_X2_S32FC_MULTIPLY_CONJUGATE_ADD
+        VOLKKernel(volk_32fc_x2_s32fc_multiply_conjugate_add_32fc),
+#else
+        FallbackKernel(volk_32fc_x2_s32fc_multiply_conjugate_add_32fc),
+#endif
+        VOLKKernel(volk_32fc_x2_square_dist_32f),
+        VOLKKernel(volk_32i_s32f_convert_32f),
+        VOLKKernel(volk_32i_x2_and_32i),
+        VOLKKernel(volk_32i_x2_or_32i),
+        VOLKKernel(volk_32u_byteswap),
+        VOLKKernel(volk_32u_reverse_32u),
+        VOLKKernel(volk_64f_convert_32f),
+        VOLKKernel(volk_64f_x2_add_64f),
+        VOLKKernel(volk_64f_x2_max_64f),
+        VOLKKernel(volk_64f_x2_min_64f),
+        VOLKKernel(volk_64f_x2_multiply_64f),
+        VOLKKernel(volk_64u_byteswap),
+        VOLKKernel(volk_64u_popcnt),
+        VOLKKernel(volk_8i_convert_16i),
+        VOLKKernel(volk_8i_s32f_convert_32f),
+        VOLKKernel(volk_8ic_deinterleave_16i_x2),
+        VOLKKernel(volk_8ic_deinterleave_real_16i),
+        VOLKKernel(volk_8ic_deinterleave_real_8i),
+        VOLKKernel(volk_8ic_s32f_deinterleave_32f_x2),
+        VOLKKernel(volk_8ic_s32f_deinterleave_real_32f),
+        VOLKKernel(volk_8ic_x2_multiply_conjugate_16ic),
+        VOLKKernel(volk_8ic_x2_s32f_multiply_conjugate_32fc),
+    };
+
+    return ModuleKernels;
+}
@@ -0,0 +1,19 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <volk/volk.h>
+
+#include <vector>
+
+struct ModuleKernel
+{
+    const char* name;
+
+    // Null if the module's fallback from Fallback.hpp is used instead.
+    volk_func_desc_t(*getFuncDesc)(void);
+};
+
+// Every VOLK kernel used by this module's blocks
+const std::vector<ModuleKernel>& getModuleKernels();
@@ -0,0 +1,311 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <complex>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+// VOLK has no double accumulator, but double precision drift is
+// negligible at any reasonable window length.
+static void accumulator_64f(double* result, const double* inputBuffer, unsigned int num_points)
+{
+    *result = std::accumulate(inputBuffer, inputBuffer + num_points, 0.0);
+}
+
+// How many inputs between exact recalculations of the running sum
+static constexpr size_t ResumInterval = 8192;
+
+//
+// Block
+//
+
+template <typename T>
+class MovingAverage: public VOLKBlock
+{
+    public:
+        using Class = MovingAverage<T>;
+        using Fcn = OneToOneFcn<T,T>;
+
+        static Pothos::Block* make(Fcn fcn, size_t decimation)
+        {
+            return new Class(fcn, decimation);
+        }
+
+        MovingAverage(Fcn fcn, size_t decimation):
+            VOLKBlock(),
+            _fcn(fcn),
+            _decimation(decimation),
+            _length(0),
+            _average(true),
+            _scale(1),
+            _sum(0),
+            _phase(0),
+            _sinceResum(0)
+        {
+            if(0 == _decimation) throw Pothos::InvalidArgumentException("Decimation must be non-zero.");
+
+            static const Pothos::DType dtype(typeid(T));
+
+            this->setupInput(0, dtype);
+            this->setupOutput(0, dtype);
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, length));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setLength));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, mode));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setMode));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, decimation));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, reset));
+
+            this->setLength(1);
+        }
+
+        virtual ~MovingAverage() = default;
+
+        size_t length() const
+        {
+            return _length;
+        }
+
+        void setLength(size_t length)
+        {
+            if(0 == length) throw Pothos::InvalidArgumentException("Length must be non-zero.");
+
+            _length = length;
+            this->_updateScale();
+            this->reset();
+        }
+
+        std::string mode() const
+        {
+            return _average ? "AVERAGE" : "SUM";
+        }
+
+        void setMode(const std::string& mode)
+        {
+            if(mode == "AVERAGE")  _average = true;
+            else if(mode == "SUM") _average = false;
+            else throw Pothos::InvalidArgumentException("Invalid mode: " + mode);
+
+            this->_updateScale();
+        }
+
+        size_t decimation() const
+        {
+            return _decimation;
+        }
+
+        void reset()
+        {
+            // Start with a window of zeros.
+            _window.assign(_length, T(0));
+            _sum = T(0);
+            _phase = 0;
+            _sinceResum = 0;
+        }
+
+        void work() override
+        {
+            auto input = this->input(0);
+            auto output = this->output(0);
+
+            // Limit the inputs so all kept outputs will fit.
+            const auto elems = std::min(
+                input->elements(),
+                output->elements() * _decimation);
+            if(0 == elems) return;
+
+            const T* inputBuffer = input->buffer();
+            T* outputBuffer = output->buffer();
+            size_t numOutputs = 0;
+
+            // If outputs are at least a window apart, there's nothing to
+            // gain from a running sum, so only sum for kept outputs.
+            if(_decimation >= _length)
+            {
+                for(size_t i = 0; i < elems; ++i)
+                {
+                    if(0 == _phase)
+                    {
+                        outputBuffer[numOutputs++] = this->_windowSum(inputBuffer, i+1) * _scale;
+                    }
+                    _phase = (_phase + 1) % _decimation;
+                }
+            }
+            else
+            {
+                // Resum periodically to bound floating-point drift.
+                const size_t resumInterval = std::max<size_t>(_length, ResumInterval);
+
+                for(size_t i = 0; i < elems; ++i)
+                {
+                    if(++_sinceResum >= resumInterval)
+                    {
+                        _sum = this->_windowSum(inputBuffer, i+1);
+                        _sinceResum = 0;
+                    }
+                    else _sum += (inputBuffer[i] - this->_at(inputBuffer, i));
+
+                    if(0 == _phase) outputBuffer[numOutputs++] = _sum * _scale;
+                    _phase = (_phase + 1) % _decimation;
+                }
+            }
+
+            // Only the last _length inputs are needed for the next call.
+            if(elems >= _length)
+            {
+                std::memcpy(
+                    _window.data(),
+                    inputBuffer + (elems - _length),
+                    _length * sizeof(T));
+            }
+            else
+            {
+                std::memmove(
+                    _window.data(),
+                    _window.data() + elems,
+                    (_length - elems) * sizeof(T));
+                std::memcpy(
+                    _window.data() + (_length - elems),
+                    inputBuffer,
+                    elems * sizeof(T));
+            }
+
+            input->consume(elems);
+            if(numOutputs > 0) output->produce(numOutputs);
+        }
+
+        void propagateLabels(const Pothos::InputPort* input) override
+        {
+            auto output = this->output(0);
+            for(const auto& label: input->labels())
+            {
+                output->postLabel(label.toAdjusted(1, _decimation));
+            }
+        }
+
+    private:
+        Fcn _fcn;
+        size_t _decimation;
+        size_t _length;
+        bool _average;
+        T _scale;
+
+        // The previous _length inputs
+        std::vector<T> _window;
+        T _sum;
+        size_t _phase;
+        size_t _sinceResum;
+
+        // Index i counts from the start of the window, so the first
+        // _length indices are in the window, and the rest are inputs.
+        T _at(const T* inputs, size_t i) const
+        {
+            return (i < _length) ? _window[i] : inputs[i - _length];
+        }
+
+        // The sum of the _length values starting at index start
+        T _windowSum(const T* inputs, size_t start) const
+        {
+            const size_t numWindow = (start < _length) ? (_length - start) : 0;
+            const size_t numInputs = _length - numWindow;
+
+            T windowSum(0);
+            if(numWindow > 0) _fcn(&windowSum, &_window[start], static_cast<unsigned int>(numWindow));
+
+            T inputSum(0);
+            if(numInputs > 0) _fcn(&inputSum, inputs + (start + numWindow - _length), static_cast<unsigned int>(numInputs));
+
+            return windowSum + inputSum;
+        }
+
+        void _updateScale()
+        {
+            _scale = _average ? T(1.0 / double(_length)) : T(1);
+        }
+};
+
+/***********************************************************************
+ * |PothosDoc Moving Average (VOLK)
+ *
+ * <p>
+ * Outputs the sum or average of the last <b>length</b> inputs. The sum
+ * is updated incrementally for each input and periodically recalculated
+ * with the VOLK accumulator kernels to bound floating-point drift. The
+ * window is initially filled with zeros.
+ * </p>
+ *
+ * <p>
+ * If <b>decimation</b> is greater than one, only every
+ * <b>decimation</b>th output is calculated and output.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_accumulator_s32f</b></li>
+ * <li><b>volk_32fc_accumulator_s32fc</b></li>
+ * </ul>
+ *
+ * |category /Stream/VOLK
+ * |category /VOLK/Stream
+ * |keywords mean smooth sliding window sum decimate
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float32=1,float64=1,cfloat32=1)
+ * |default "float32"
+ * |preview disable
+ *
+ * |param decimation[Decimation]
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview enable
+ *
+ * |param length[Length]
+ * The number of inputs in the window.
+ * |widget SpinBox(minimum=1)
+ * |default 16
+ * |preview enable
+ *
+ * |param mode[Mode]
+ * |widget ComboBox(editable=false)
+ * |default "AVERAGE"
+ * |option [Average] "AVERAGE"
+ * |option [Sum] "SUM"
+ * |preview enable
+ *
+ * |factory /volk/moving_average(dtype,decimation)
+ * |setter setLength(length)
+ * |setter setMode(mode)
+ **********************************************************************/
+static const std::string VOLKMovingAveragePath = "/volk/moving_average";
+
+static Pothos::Block* makeMovingAverage(
+    const Pothos::DType& dtype,
+    size_t decimation)
+{
+    #define IfTypeThenMovingAverage(type,fcn) \
+        if(doesDTypeMatch<type>(dtype)) return MovingAverage<type>::make(fcn, decimation);
+
+    IfTypeThenMovingAverage(float,volk_32f_accumulator_s32f)
+    IfTypeThenMovingAverage(double,accumulator_64f)
+    IfTypeThenMovingAverage(std::complex<float>,volk_32fc_accumulator_s32fc)
+
+    throw InvalidDTypeException(VOLKMovingAveragePath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKMovingAverage(
+    VOLKMovingAveragePath,
+    &makeMovingAverage);
@@ -0,0 +1,265 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+//
+// Packing functions
+//
+
+// Each function packs eight inputs per output byte, with the first input
+// in the least significant bit. With SSE2, the comparison results are
+// gathered with a movemask instead of one shift per bit.
+
+static void packBitsInt8(uint8_t* output, const int8_t* input, size_t numBytes)
+{
+    size_t byte = 0;
+
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    for(; (byte + 2) <= numBytes; byte += 2, input += 16)
+    {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        const auto mask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(values, zero));
+
+        output[byte]   = uint8_t(mask & 0xFF);
+        output[byte+1] = uint8_t((mask >> 8) & 0xFF);
+    }
+#endif
+
+    for(; byte < numBytes; ++byte, input += 8)
+    {
+        uint8_t packed = 0;
+        for(size_t bit = 0; bit < 8; ++bit) packed |= uint8_t((input[bit] != 0) << bit);
+
+        output[byte] = packed;
+    }
+}
+
+// Matches volk_32f_binary_slicer_8i, where inputs >= 0 are ones.
+static void packBitsFloat(uint8_t* output, const float* input, size_t numBytes)
+{
+    size_t byte = 0;
+
+#ifdef __SSE2__
+    const __m128 zero = _mm_setzero_ps();
+    for(; byte < numBytes; ++byte, input += 8)
+    {
+        const auto lower = _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(input), zero));
+        const auto upper = _mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(input + 4), zero));
+
+        output[byte] = uint8_t(lower | (upper << 4));
+    }
+#endif
+
+    for(; byte < numBytes; ++byte, input += 8)
+    {
+        uint8_t packed = 0;
+        for(size_t bit = 0; bit < 8; ++bit) packed |= uint8_t((input[bit] >= 0.0f) << bit);
+
+        output[byte] = packed;
+    }
+}
+
+static std::array<uint8_t, 256> getBitReversalTable()
+{
+    std::array<uint8_t, 256> table;
+    for(size_t value = 0; value < table.size(); ++value)
+    {
+        uint8_t reversed = 0;
+        for(size_t bit = 0; bit < 8; ++bit)
+        {
+            if(value & (1 << bit)) reversed |= uint8_t(0x80 >> bit);
+        }
+
+        table[value] = reversed;
+    }
+
+    return table;
+}
+
+//
+// Interface
+//
+
+class PackBits: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make(const Pothos::DType& dtype);
+
+        PackBits(const Pothos::DType& dtype);
+        virtual ~PackBits() = default;
+
+        std::string bitOrder() const
+        {
+            return _msbFirst ? "MSB" : "LSB";
+        }
+
+        void setBitOrder(const std::string& bitOrder);
+
+        void work() override;
+
+        void propagateLabels(const Pothos::InputPort* input) override;
+
+    private:
+        bool _msbFirst;
+
+        using PackFcn = void(PackBits::*)(uint8_t*, const Pothos::BufferChunk&, size_t);
+        PackFcn _pack;
+
+        void _packInt8(uint8_t* output, const Pothos::BufferChunk& input, size_t numBytes);
+        void _packFloat(uint8_t* output, const Pothos::BufferChunk& input, size_t numBytes);
+};
+
+//
+// Implementation
+//
+
+static const std::string VOLKPackBitsPath = "/volk/pack_bits";
+
+Pothos::Block* PackBits::make(const Pothos::DType& dtype)
+{
+    return new PackBits(dtype);
+}
+
+PackBits::PackBits(const Pothos::DType& dtype):
+    VOLKBlock(),
+    _msbFirst(true),
+    _pack(nullptr)
+{
+    if(doesDTypeMatch<int8_t>(dtype))     _pack = &PackBits::_packInt8;
+    else if(doesDTypeMatch<float>(dtype)) _pack = &PackBits::_packFloat;
+    else throw InvalidDTypeException(VOLKPackBitsPath, dtype);
+
+    this->setupInput(0, dtype);
+    this->setupOutput(0, "uint8");
+
+    // Each output needs eight inputs.
+    this->input(0)->setReserve(8);
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PackBits, bitOrder));
+    this->registerCall(this, POTHOS_FCN_TUPLE(PackBits, setBitOrder));
+}
+
+void PackBits::setBitOrder(const std::string& bitOrder)
+{
+    if(bitOrder == "MSB")      _msbFirst = true;
+    else if(bitOrder == "LSB") _msbFirst = false;
+    else throw Pothos::InvalidArgumentException("Invalid bit order: " + bitOrder);
+}
+
+void PackBits::work()
+{
+    assert(_pack);
+
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const auto numBytes = std::min(
+        input->elements() / 8,
+        output->elements());
+    if(0 == numBytes) return;
+
+    uint8_t* outputBuffer = output->buffer();
+    std::mem_fn(_pack)(
+        this,
+        outputBuffer,
+        input->buffer(),
+        numBytes);
+
+    // Packing is LSB-first, so reverse the bits of each output while
+    // it's still in the cache.
+    if(_msbFirst)
+    {
+        static const auto BitReversalTable = getBitReversalTable();
+        for(size_t byte = 0; byte < numBytes; ++byte)
+        {
+            outputBuffer[byte] = BitReversalTable[outputBuffer[byte]];
+        }
+    }
+
+    input->consume(numBytes * 8);
+    output->produce(numBytes);
+}
+
+void PackBits::propagateLabels(const Pothos::InputPort* input)
+{
+    auto output = this->output(0);
+    for(const auto& label: input->labels())
+    {
+        output->postLabel(label.toAdjusted(1, 8));
+    }
+}
+
+void PackBits::_packInt8(
+    uint8_t* output,
+    const Pothos::BufferChunk& input,
+    size_t numBytes)
+{
+    packBitsInt8(output, input.as<const int8_t*>(), numBytes);
+}
+
+void PackBits::_packFloat(
+    uint8_t* output,
+    const Pothos::BufferChunk& input,
+    size_t numBytes)
+{
+    packBitsFloat(output, input.as<const float*>(), numBytes);
+}
+
+/***********************************************************************
+ * |PothosDoc Pack Bits (VOLK)
+ *
+ * <p>
+ * Packs each group of eight bits into one byte, in the given bit order.
+ * This avoids downstream blocks processing one byte per bit.
+ * </p>
+ *
+ * <p>
+ * For int8 inputs, such as the output of <b>/volk/binary_slicer</b>,
+ * each non-zero input is a one. For float32 inputs, each input is
+ * sliced as in <b>volk_32f_binary_slicer_8i</b>, where inputs
+ * <b>>= 0</b> are ones, and packed in the same pass.
+ * </p>
+ *
+ * <p>
+ * With SSE2, eight or more bits are packed at once with a movemask.
+ * </p>
+ *
+ * |category /Digital/VOLK
+ * |category /VOLK/Digital
+ * |keywords bit byte pack slicer
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(int8=1,float32=1)
+ * |default "int8"
+ * |preview disable
+ *
+ * |param bitOrder[Bit Order]
+ * The position of the first input bit in each output byte.
+ * |widget ComboBox(editable=false)
+ * |default "MSB"
+ * |option [MSB First] "MSB"
+ * |option [LSB First] "LSB"
+ * |preview enable
+ *
+ * |factory /volk/pack_bits(dtype)
+ * |setter setBitOrder(bitOrder)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKPackBits(
+    VOLKPackBitsPath,
+    &PackBits::make);
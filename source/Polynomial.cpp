@@ -0,0 +1,122 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <algorithm>
+#include <vector>
+
+//
+// Interface
+//
+
+class Polynomial: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        Polynomial();
+        virtual ~Polynomial() = default;
+
+        std::vector<float> coefficients() const
+        {
+            return _coefficients;
+        }
+
+        void setCoefficients(const std::vector<float>& coefficients);
+
+        void work() override;
+
+    private:
+        std::vector<float> _coefficients;
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* Polynomial::make()
+{
+    return new Polynomial();
+}
+
+Polynomial::Polynomial(): VOLKBlock(), _coefficients({0.0f, 1.0f})
+{
+    this->setupInput(0, "float32");
+    this->setupOutput(0, "float32");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(Polynomial, coefficients));
+    this->registerCall(this, POTHOS_FCN_TUPLE(Polynomial, setCoefficients));
+}
+
+// Calls are serialized with work(), so new coefficients always apply
+// starting at the next work() call.
+void Polynomial::setCoefficients(const std::vector<float>& coefficients)
+{
+    if(coefficients.empty()) throw Pothos::InvalidArgumentException("At least one coefficient must be given.");
+
+    _coefficients = coefficients;
+}
+
+void Polynomial::work()
+{
+    const auto elems = this->workInfo().minElements;
+    if(0 == elems) return;
+
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const float* inputBuffer = input->buffer();
+    float* outputBuffer = output->buffer();
+
+    // Horner's method, starting with the highest-order coefficient.
+    // VOLK has no fused multiply-add kernel, so each coefficient is a
+    // single multiply-add pass over the tile, in a plain loop the
+    // compiler can vectorize.
+    for(size_t offset = 0; offset < elems; offset += TileElems)
+    {
+        const auto tileElems = std::min<size_t>(TileElems, elems - offset);
+
+        const float* x = inputBuffer + offset;
+        float* y = outputBuffer + offset;
+
+        std::fill(y, y + tileElems, _coefficients.back());
+
+        for(auto coeffIter = _coefficients.rbegin()+1; coeffIter != _coefficients.rend(); ++coeffIter)
+        {
+            const float coeff = *coeffIter;
+            for(size_t i = 0; i < tileElems; ++i) y[i] = (y[i] * x[i]) + coeff;
+        }
+    }
+
+    input->consume(elems);
+    output->produce(elems);
+}
+
+/***********************************************************************
+ * |PothosDoc Polynomial (VOLK)
+ *
+ * <p>
+ * Evaluates a polynomial of arbitrary order for each input, using
+ * Horner's method over cache-sized tiles of the input. Each coefficient
+ * is applied with a single multiply-add pass over the tile.
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math polynomial horner calibration
+ *
+ * |param coefficients[Coefficients]
+ * The polynomial coefficients, in ascending order of power.
+ * |widget LineEdit()
+ * |default [0.0, 1.0]
+ * |preview enable
+ *
+ * |factory /volk/polynomial()
+ * |setter setCoefficients(coefficients)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKPolynomial(
+    "/volk/polynomial",
+    &Polynomial::make);
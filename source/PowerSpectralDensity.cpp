@@ -1,7 +1,7 @@
 // Copyright 2021,2023 Nicholas Corgan
 // SPDX-License-Identifier: GPL-3.0-or-later
 
-#include "VOLKBlock.hpp"
+#include "PowerSpectrumBlock.hpp"
 
 #include <volk/volk.h>
 
@@ -9,7 +9,7 @@
 // Interface
 //
 
-class PowerSpectralDensity: public VOLKBlock
+class PowerSpectralDensity: public PowerSpectrumBlock
 {
     public:
         static Pothos::Block* make();
@@ -17,16 +17,6 @@ class PowerSpectralDensity: public VOLKBlock
         PowerSpectralDensity();
         virtual ~PowerSpectralDensity() = default;
 
-        float normalizationFactor() const
-        {
-            return _normalizationFactor;
-        }
-
-        void setNormalizationFactor(float normalizationFactor)
-        {
-            _normalizationFactor = normalizationFactor;
-        }
-
         float rbw() const
         {
             return _rbw;
@@ -37,10 +27,18 @@ class PowerSpectralDensity: public VOLKBlock
             _rbw = rbw;
         }
 
-        void work() override;
+    protected:
+        void _directWork(
+            float* output,
+            const std::complex<float>* input,
+            size_t elems) override;
+
+        float _powerScale() const override
+        {
+            return 1.0f / _rbw;
+        }
 
     private:
-        float _normalizationFactor;
         float _rbw;
 };
 
@@ -54,37 +52,31 @@ Pothos::Block* PowerSpectralDensity::make()
 }
 
 PowerSpectralDensity::PowerSpectralDensity():
-    VOLKBlock(),
-    _normalizationFactor(1.0f),
+    PowerSpectrumBlock(),
     _rbw(1.0f)
 {
-    this->setupInput(0, "complex_float32");
-    this->setupOutput(0, "float32");
-
-    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectralDensity, normalizationFactor));
-    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectralDensity, setNormalizationFactor));
-
     this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectralDensity, rbw));
     this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectralDensity, setRBW));
+
+    this->_registerSetterLabel(
+        "setRBW",
+        [this](const Pothos::Object& value)
+        {
+            this->setRBW(value.convert<float>());
+        });
 }
 
-void PowerSpectralDensity::work()
+void PowerSpectralDensity::_directWork(
+    float* output,
+    const std::complex<float>* input,
+    size_t elems)
 {
-    const auto elems = this->workInfo().minElements;
-    if(0 == elems) return;
-
-    auto input = this->input(0);
-    auto output = this->output(0);
-
     volk_32fc_s32f_x2_power_spectral_density_32f(
-        output->buffer(),
-        input->buffer(),
-        _normalizationFactor,
+        output,
+        input,
+        this->normalizationFactor(),
         _rbw,
         static_cast<unsigned int>(elems));
-
-    input->consume(elems);
-    output->produce(elems);
 }
 
 /***********************************************************************
@@ -96,13 +88,36 @@ void PowerSpectralDensity::work()
  * </p>
  *
  * <p>
- * Underlying function: <b>volk_32fc_s32f_x2_power_spectral_density_32f</b>
+ * Optionally, the linear power of each bin can be accumulated over
+ * <b>numFrames</b> frames of <b>fftSize</b> points, outputting one
+ * frame per <b>numFrames</b> input frames. In this case, the log10
+ * conversion is only done once per output frame.
+ * </p>
+ *
+ * <p>
+ * The normalization factor and RBW can also be set by input labels with
+ * the IDs <b>setNormalizationFactor</b> and <b>setRBW</b>. These take
+ * effect at the labeled sample, or at the start of the labeled frame
+ * when averaging.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
  * </p>
  *
+ * <ul>
+ * <li><b>volk_32fc_s32f_x2_power_spectral_density_32f</b> (no averaging)</li>
+ * <li><b>volk_32fc_magnitude_squared_32f</b> (averaging)</li>
+ * <li><b>volk_32f_x2_add_32f</b> (linear/exponential averaging)</li>
+ * <li><b>volk_32f_x2_max_32f</b> (max-hold)</li>
+ * <li><b>volk_32f_x2_min_32f</b> (min-hold)</li>
+ * <li><b>volk_32f_log2_32f</b> (averaging)</li>
+ * </ul>
+ *
  * |category /Math/VOLK
  * |category /FFT/VOLK
  * |category /VOLK/Math
- * |keywords math rf
+ * |keywords math rf average waterfall
  *
  * |param normalizationFactor[Normalization Factor]
  * Divided against all input values before the power is calculated.
@@ -116,9 +131,43 @@ void PowerSpectralDensity::work()
  * |default 1.0
  * |preview enable
  *
+ * |param averagingMode[Averaging Mode]
+ * How the power of each bin is combined across frames.
+ * |widget ComboBox(editable=false)
+ * |default "NONE"
+ * |option [None] "NONE"
+ * |option [Linear] "LINEAR"
+ * |option [Exponential] "EXPONENTIAL"
+ * |option [Max Hold] "MAX_HOLD"
+ * |option [Min Hold] "MIN_HOLD"
+ * |preview enable
+ *
+ * |param fftSize[FFT Size]
+ * The number of points in each frame. Ignored if no averaging is done.
+ * |widget SpinBox(minimum=1)
+ * |default 1024
+ * |preview valid
+ *
+ * |param numFrames[Num Frames]
+ * The number of input frames combined into each output frame. Ignored
+ * if no averaging is done.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview valid
+ *
+ * |param alpha[Alpha]
+ * The weight of each new frame in exponential averaging.
+ * |widget DoubleSpinBox(minimum=0,maximum=1,step=0.01,decimals=3)
+ * |default 0.1
+ * |preview valid
+ *
  * |factory /volk/power_spectral_density()
  * |setter setNormalizationFactor(normalizationFactor)
  * |setter setRBW(rbw)
+ * |setter setFFTSize(fftSize)
+ * |setter setNumFrames(numFrames)
+ * |setter setAlpha(alpha)
+ * |setter setAveragingMode(averagingMode)
  **********************************************************************/
 static Pothos::BlockRegistry registerVOLKPowerSpectralDensity(
     "/volk/power_spectral_density",
@@ -0,0 +1,130 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "PowerSpectrumBlock.hpp"
+
+#include <volk/volk.h>
+
+//
+// Interface
+//
+
+class PowerSpectrum: public PowerSpectrumBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        PowerSpectrum() = default;
+        virtual ~PowerSpectrum() = default;
+
+    protected:
+        void _directWork(
+            float* output,
+            const std::complex<float>* input,
+            size_t elems) override;
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* PowerSpectrum::make()
+{
+    return new PowerSpectrum();
+}
+
+void PowerSpectrum::_directWork(
+    float* output,
+    const std::complex<float>* input,
+    size_t elems)
+{
+    volk_32fc_s32f_power_spectrum_32f(
+        output,
+        input,
+        this->normalizationFactor(),
+        static_cast<unsigned int>(elems));
+}
+
+/***********************************************************************
+ * |PothosDoc Power Spectrum (VOLK)
+ *
+ * <p>
+ * Calculates the log10 power value for each input.
+ * </p>
+ *
+ * <p>
+ * Optionally, the linear power of each bin can be accumulated over
+ * <b>numFrames</b> frames of <b>fftSize</b> points, outputting one
+ * frame per <b>numFrames</b> input frames. In this case, the log10
+ * conversion is only done once per output frame.
+ * </p>
+ *
+ * <p>
+ * The normalization factor can also be set by input labels with the ID
+ * <b>setNormalizationFactor</b>. These take effect at the labeled
+ * sample, or at the start of the labeled frame when averaging.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32fc_s32f_power_spectrum_32f</b> (no averaging)</li>
+ * <li><b>volk_32fc_magnitude_squared_32f</b> (averaging)</li>
+ * <li><b>volk_32f_x2_add_32f</b> (linear/exponential averaging)</li>
+ * <li><b>volk_32f_x2_max_32f</b> (max-hold)</li>
+ * <li><b>volk_32f_x2_min_32f</b> (min-hold)</li>
+ * <li><b>volk_32f_log2_32f</b> (averaging)</li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math rf average waterfall
+ *
+ * |param normalizationFactor[Normalization Factor]
+ * Divided against all input values before the power is calculated.
+ * |widget DoubleSpinBox(decimals=3)
+ * |default 1.0
+ * |preview enable
+ *
+ * |param averagingMode[Averaging Mode]
+ * How the power of each bin is combined across frames.
+ * |widget ComboBox(editable=false)
+ * |default "NONE"
+ * |option [None] "NONE"
+ * |option [Linear] "LINEAR"
+ * |option [Exponential] "EXPONENTIAL"
+ * |option [Max Hold] "MAX_HOLD"
+ * |option [Min Hold] "MIN_HOLD"
+ * |preview enable
+ *
+ * |param fftSize[FFT Size]
+ * The number of points in each frame. Ignored if no averaging is done.
+ * |widget SpinBox(minimum=1)
+ * |default 1024
+ * |preview valid
+ *
+ * |param numFrames[Num Frames]
+ * The number of input frames combined into each output frame. Ignored
+ * if no averaging is done.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview valid
+ *
+ * |param alpha[Alpha]
+ * The weight of each new frame in exponential averaging.
+ * |widget DoubleSpinBox(minimum=0,maximum=1,step=0.01,decimals=3)
+ * |default 0.1
+ * |preview valid
+ *
+ * |factory /volk/power_spectrum()
+ * |setter setNormalizationFactor(normalizationFactor)
+ * |setter setFFTSize(fftSize)
+ * |setter setNumFrames(numFrames)
+ * |setter setAlpha(alpha)
+ * |setter setAveragingMode(averagingMode)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKPowerSpectrum(
+    "/volk/power_spectrum",
+    &PowerSpectrum::make);
@@ -0,0 +1,305 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "PowerSpectrumBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <cmath>
+#include <cstring>
+
+// Converts log2 to dB (10*log10(x) = (10/log2(10))*log2(x))
+static const float Log2ToDBFactor = 10.0f / std::log2(10.0f);
+
+// Matches the VOLK kernels so a zero input doesn't give -inf.
+static constexpr float PowerFloor = 1e-20f;
+
+PowerSpectrumBlock::PowerSpectrumBlock():
+    VOLKBlock(),
+    _normalizationFactor(1.0f),
+    _fftSize(1024),
+    _numFrames(1),
+    _averagingMode(AveragingMode::None),
+    _alpha(0.1f),
+    _framesAccumulated(0),
+    _accumulatorValid(false)
+{
+    this->setupInput(0, "complex_float32");
+    this->setupOutput(0, "float32");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, normalizationFactor));
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, setNormalizationFactor));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, fftSize));
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, setFFTSize));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, numFrames));
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, setNumFrames));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, averagingMode));
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, setAveragingMode));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, alpha));
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, setAlpha));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(PowerSpectrumBlock, reset));
+
+    this->_registerSetterLabel(
+        "setNormalizationFactor",
+        [this](const Pothos::Object& value)
+        {
+            this->setNormalizationFactor(value.convert<float>());
+        });
+
+    this->reset();
+}
+
+void PowerSpectrumBlock::setFFTSize(size_t fftSize)
+{
+    if(0 == fftSize) throw Pothos::InvalidArgumentException("FFT size must be non-zero.");
+
+    _fftSize = fftSize;
+    this->reset();
+}
+
+void PowerSpectrumBlock::setNumFrames(size_t numFrames)
+{
+    if(0 == numFrames) throw Pothos::InvalidArgumentException("Number of frames must be non-zero.");
+
+    _numFrames = numFrames;
+    this->reset();
+}
+
+std::string PowerSpectrumBlock::averagingMode() const
+{
+    switch(_averagingMode)
+    {
+        case AveragingMode::Linear:      return "LINEAR";
+        case AveragingMode::Exponential: return "EXPONENTIAL";
+        case AveragingMode::MaxHold:     return "MAX_HOLD";
+        case AveragingMode::MinHold:     return "MIN_HOLD";
+        default:                         return "NONE";
+    }
+}
+
+void PowerSpectrumBlock::setAveragingMode(const std::string& averagingMode)
+{
+    if(averagingMode == "NONE")             _averagingMode = AveragingMode::None;
+    else if(averagingMode == "LINEAR")      _averagingMode = AveragingMode::Linear;
+    else if(averagingMode == "EXPONENTIAL") _averagingMode = AveragingMode::Exponential;
+    else if(averagingMode == "MAX_HOLD")    _averagingMode = AveragingMode::MaxHold;
+    else if(averagingMode == "MIN_HOLD")    _averagingMode = AveragingMode::MinHold;
+    else throw Pothos::InvalidArgumentException("Invalid averaging mode: " + averagingMode);
+
+    this->reset();
+}
+
+void PowerSpectrumBlock::setAlpha(float alpha)
+{
+    if((alpha <= 0.0f) || (alpha > 1.0f))
+    {
+        throw Pothos::RangeException("Alpha must be in the range (0,1].");
+    }
+
+    _alpha = alpha;
+}
+
+void PowerSpectrumBlock::reset()
+{
+    _accumulator.assign(_fftSize, 0.0f);
+    _framePower.assign(_fftSize, 0.0f);
+    _framesAccumulated = 0;
+    _accumulatorValid = false;
+
+    this->_updateReserve();
+}
+
+void PowerSpectrumBlock::work()
+{
+    auto input = this->input(0);
+
+    if(AveragingMode::None == _averagingMode)
+    {
+        const auto elems = this->workInfo().minElements;
+        if(0 == elems) return;
+
+        auto output = this->output(0);
+
+        float* outputBuffer = output->buffer();
+        const std::complex<float>* inputBuffer = input->buffer();
+
+        for(size_t offset = 0; offset < elems;)
+        {
+            const auto spanElems = this->_setterLabelSpan(input, offset, elems);
+
+            this->_directWork(
+                outputBuffer + offset,
+                inputBuffer + offset,
+                spanElems);
+
+            offset += spanElems;
+        }
+
+        input->consume(elems);
+        output->produce(elems);
+        return;
+    }
+
+    const auto numInputFrames = input->elements() / _fftSize;
+    if(0 == numInputFrames) return;
+
+    auto output = this->output(0);
+    const std::complex<float>* inputBuffer = input->buffer();
+
+    for(size_t frame = 0; frame < numInputFrames; ++frame)
+    {
+        // When averaging, setter labels apply from the start of their
+        // frame, as each frame is normalized when it's accumulated.
+        const auto frameOffset = frame * _fftSize;
+        this->_applySetterLabels(input, frameOffset, frameOffset + _fftSize);
+
+        this->_accumulateFrame(inputBuffer + frameOffset);
+        if(_framesAccumulated == _numFrames) this->_emitFrame(output);
+    }
+
+    input->consume(numInputFrames * _fftSize);
+}
+
+void PowerSpectrumBlock::propagateLabels(const Pothos::InputPort* input)
+{
+    if(AveragingMode::None == _averagingMode)
+    {
+        VOLKBlock::propagateLabels(input);
+        return;
+    }
+
+    auto output = this->output(0);
+    for(const auto& label: input->labels())
+    {
+        if(this->_isSetterLabel(label)) continue;
+        output->postLabel(label.toAdjusted(1, _numFrames));
+    }
+}
+
+void PowerSpectrumBlock::_accumulateFrame(const std::complex<float>* frame)
+{
+    const auto fftSize = static_cast<unsigned int>(_fftSize);
+
+    // The VOLK kernels normalize the complex inputs, so the equivalent
+    // power scale is the square of the inverse.
+    const float powerScale = this->_powerScale() / (_normalizationFactor * _normalizationFactor);
+
+    // The first frame of an average can be written straight into the
+    // accumulator without combining.
+    if(!_accumulatorValid)
+    {
+        volk_32fc_magnitude_squared_32f(
+            _accumulator.data(),
+            frame,
+            fftSize);
+        if(1.0f != powerScale)
+        {
+            volk_32f_s32f_multiply_32f(
+                _accumulator.data(),
+                _accumulator.data(),
+                powerScale,
+                fftSize);
+        }
+
+        _accumulatorValid = true;
+        ++_framesAccumulated;
+        return;
+    }
+
+    volk_32fc_magnitude_squared_32f(
+        _framePower.data(),
+        frame,
+        fftSize);
+
+    // Exponential averaging weights the new frame in the same pass.
+    const float frameScale = (AveragingMode::Exponential == _averagingMode) ? (_alpha * powerScale) : powerScale;
+    if(1.0f != frameScale)
+    {
+        volk_32f_s32f_multiply_32f(
+            _framePower.data(),
+            _framePower.data(),
+            frameScale,
+            fftSize);
+    }
+
+    switch(_averagingMode)
+    {
+        case AveragingMode::Linear:
+            volk_32f_x2_add_32f(
+                _accumulator.data(),
+                _accumulator.data(),
+                _framePower.data(),
+                fftSize);
+            break;
+
+        case AveragingMode::Exponential:
+            volk_32f_s32f_multiply_32f(
+                _accumulator.data(),
+                _accumulator.data(),
+                (1.0f - _alpha),
+                fftSize);
+            volk_32f_x2_add_32f(
+                _accumulator.data(),
+                _accumulator.data(),
+                _framePower.data(),
+                fftSize);
+            break;
+
+        case AveragingMode::MaxHold:
+            volk_32f_x2_max_32f(
+                _accumulator.data(),
+                _accumulator.data(),
+                _framePower.data(),
+                fftSize);
+            break;
+
+        case AveragingMode::MinHold:
+            volk_32f_x2_min_32f(
+                _accumulator.data(),
+                _accumulator.data(),
+                _framePower.data(),
+                fftSize);
+            break;
+
+        default:
+            break;
+    }
+
+    ++_framesAccumulated;
+}
+
+void PowerSpectrumBlock::_emitFrame(Pothos::OutputPort* output)
+{
+    const auto fftSize = static_cast<unsigned int>(_fftSize);
+
+    // Each frame was normalized and scaled when accumulated.
+    const float scale = (AveragingMode::Linear == _averagingMode) ? (1.0f / float(_numFrames)) : 1.0f;
+
+    auto outputBuffer = output->getBuffer(_fftSize);
+    float* outputPtr = outputBuffer;
+
+    volk_32f_s32f_multiply_32f(outputPtr, _accumulator.data(), scale, fftSize);
+    volk_32f_s32f_add_32f(outputPtr, outputPtr, PowerFloor, fftSize);
+    volk_32f_log2_32f(outputPtr, outputPtr, fftSize);
+    volk_32f_s32f_multiply_32f(outputPtr, outputPtr, Log2ToDBFactor, fftSize);
+
+    output->postBuffer(std::move(outputBuffer));
+
+    // Exponential averaging carries over between outputs.
+    _framesAccumulated = 0;
+    if(AveragingMode::Exponential != _averagingMode) _accumulatorValid = false;
+}
+
+void PowerSpectrumBlock::_updateReserve()
+{
+    const size_t reserve = (AveragingMode::None == _averagingMode) ? 0 : _fftSize;
+    this->input(0)->setReserve(reserve);
+}
@@ -0,0 +1,106 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include "VOLKBlock.hpp"
+
+#include <complex>
+#include <string>
+#include <vector>
+
+//
+// Shared functionality for blocks that output a spectrum in dB. By
+// default, each input point is converted directly, but the block can
+// optionally accumulate the linear power over multiple frames and only
+// convert to dB once per output frame.
+//
+
+class PowerSpectrumBlock: public VOLKBlock
+{
+    public:
+        PowerSpectrumBlock();
+        virtual ~PowerSpectrumBlock() = default;
+
+        float normalizationFactor() const
+        {
+            return _normalizationFactor;
+        }
+
+        void setNormalizationFactor(float normalizationFactor)
+        {
+            _normalizationFactor = normalizationFactor;
+        }
+
+        size_t fftSize() const
+        {
+            return _fftSize;
+        }
+
+        void setFFTSize(size_t fftSize);
+
+        size_t numFrames() const
+        {
+            return _numFrames;
+        }
+
+        void setNumFrames(size_t numFrames);
+
+        std::string averagingMode() const;
+
+        void setAveragingMode(const std::string& averagingMode);
+
+        float alpha() const
+        {
+            return _alpha;
+        }
+
+        void setAlpha(float alpha);
+
+        void reset();
+
+        void work() override;
+
+        void propagateLabels(const Pothos::InputPort* input) override;
+
+    protected:
+        // Used when no averaging is done, converting each input point
+        // directly to dB.
+        virtual void _directWork(
+            float* output,
+            const std::complex<float>* input,
+            size_t elems) = 0;
+
+        // Applied to the linear power of each frame as it's accumulated,
+        // along with the normalization factor.
+        virtual float _powerScale() const
+        {
+            return 1.0f;
+        }
+
+    private:
+        enum class AveragingMode
+        {
+            None,
+            Linear,
+            Exponential,
+            MaxHold,
+            MinHold
+        };
+
+        float _normalizationFactor;
+        size_t _fftSize;
+        size_t _numFrames;
+        AveragingMode _averagingMode;
+        float _alpha;
+
+        // Linear power, accumulated across frames
+        std::vector<float> _accumulator;
+        std::vector<float> _framePower;
+        size_t _framesAccumulated;
+        bool _accumulatorValid;
+
+        void _accumulateFrame(const std::complex<float>* frame);
+        void _emitFrame(Pothos::OutputPort* output);
+        void _updateReserve();
+};
@@ -0,0 +1,381 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "VOLKBlock.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// VOLK has no saturating complex int16 kernels, and volk_16ic_x2_multiply_16ic
+// wraps instead of scaling, so these are implemented here. Each processes the
+// real and imaginary parts as interleaved int16 values, four complex values
+// per SSE2 register.
+
+using ComplexInt16 = std::complex<int16_t>;
+
+//
+// Scalar helpers
+//
+
+static inline int16_t saturate16(int64_t value)
+{
+    return int16_t(std::min<int64_t>(
+        std::max<int64_t>(value, std::numeric_limits<int16_t>::min()),
+        std::numeric_limits<int16_t>::max()));
+}
+
+// Rounds a Q30 product to Q15, rounding halves up. This is computed as
+// ((x >> 14) + 1) >> 1 so the SIMD version can't overflow.
+static inline int16_t roundQ15(int64_t product)
+{
+    return saturate16(((product >> 14) + 1) >> 1);
+}
+
+static inline int16_t toQ15(float value)
+{
+    return saturate16(int64_t(std::lround(double(value) * 32768.0)));
+}
+
+#ifdef __SSE2__
+
+//
+// SSE2 helpers
+//
+
+// x0*y0 + x1*y1 for each pair of int16 values. This only overflows when all
+// four are -32768, whose sum of 2^31 wraps to INT_MIN, which no other inputs
+// produce, so it's saturated to INT_MAX instead.
+static inline __m128i maddSaturated(__m128i x, __m128i y)
+{
+    const __m128i sum = _mm_madd_epi16(x, y);
+    const __m128i overflowed = _mm_cmpeq_epi32(sum, _mm_set1_epi32(std::numeric_limits<int32_t>::min()));
+
+    return _mm_xor_si128(sum, overflowed);
+}
+
+// x0*y0 - x1*y1 for each pair of int16 values, which can't overflow
+static inline __m128i mdiff(__m128i x, __m128i y)
+{
+    const __m128i lo = _mm_mullo_epi16(x, y);
+    const __m128i hi = _mm_mulhi_epi16(x, y);
+
+    const __m128 products0 = _mm_castsi128_ps(_mm_unpacklo_epi16(lo, hi));
+    const __m128 products1 = _mm_castsi128_ps(_mm_unpackhi_epi16(lo, hi));
+
+    const __m128i first = _mm_castps_si128(_mm_shuffle_ps(products0, products1, _MM_SHUFFLE(2,0,2,0)));
+    const __m128i second = _mm_castps_si128(_mm_shuffle_ps(products0, products1, _MM_SHUFFLE(3,1,3,1)));
+
+    return _mm_sub_epi32(first, second);
+}
+
+// Rounds the Q30 real and imaginary parts to Q15 and interleaves them.
+static inline __m128i packQ15(__m128i real, __m128i imag)
+{
+    const __m128i one = _mm_set1_epi32(1);
+
+    real = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(real, 14), one), 1);
+    imag = _mm_srai_epi32(_mm_add_epi32(_mm_srai_epi32(imag, 14), one), 1);
+
+    return _mm_unpacklo_epi16(_mm_packs_epi32(real, real), _mm_packs_epi32(imag, imag));
+}
+
+// Swaps the real and imaginary parts of each complex value.
+static inline __m128i swapParts(__m128i vec)
+{
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(vec, 0xB1), 0xB1);
+}
+
+#endif
+
+//
+// Kernels
+//
+
+static void add_16ic_saturated(
+    ComplexInt16* output,
+    const ComplexInt16* input0,
+    const ComplexInt16* input1,
+    unsigned int num_points)
+{
+    const int16_t* in0 = reinterpret_cast<const int16_t*>(input0);
+    const int16_t* in1 = reinterpret_cast<const int16_t*>(input1);
+    int16_t* out = reinterpret_cast<int16_t*>(output);
+    const unsigned int numValues = num_points * 2;
+
+    unsigned int number = 0;
+
+#ifdef __SSE2__
+    for(; (number + 8) <= numValues; number += 8)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in0 + number));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in1 + number));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + number), _mm_adds_epi16(a, b));
+    }
+#endif
+
+    for(; number < numValues; ++number) out[number] = saturate16(int64_t(in0[number]) + in1[number]);
+}
+
+static void subtract_16ic_saturated(
+    ComplexInt16* output,
+    const ComplexInt16* input0,
+    const ComplexInt16* input1,
+    unsigned int num_points)
+{
+    const int16_t* in0 = reinterpret_cast<const int16_t*>(input0);
+    const int16_t* in1 = reinterpret_cast<const int16_t*>(input1);
+    int16_t* out = reinterpret_cast<int16_t*>(output);
+    const unsigned int numValues = num_points * 2;
+
+    unsigned int number = 0;
+
+#ifdef __SSE2__
+    for(; (number + 8) <= numValues; number += 8)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in0 + number));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in1 + number));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + number), _mm_subs_epi16(a, b));
+    }
+#endif
+
+    for(; number < numValues; ++number) out[number] = saturate16(int64_t(in0[number]) - in1[number]);
+}
+
+static void conjugate_16ic_saturated(
+    ComplexInt16* output,
+    const ComplexInt16* input,
+    unsigned int num_points)
+{
+    unsigned int number = 0;
+
+#ifdef __SSE2__
+    // Only the imaginary parts, in the upper half of each 32-bit lane
+    const __m128i imagMask = _mm_set1_epi32(int32_t(0xFFFF0000));
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; (number + 4) <= num_points; number += 4)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + number));
+        const __m128i negated = _mm_subs_epi16(zero, a);
+
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + number),
+            _mm_or_si128(_mm_and_si128(imagMask, negated), _mm_andnot_si128(imagMask, a)));
+    }
+#endif
+
+    for(; number < num_points; ++number)
+    {
+        output[number] = ComplexInt16(input[number].real(), saturate16(-int64_t(input[number].imag())));
+    }
+}
+
+static void multiply_conjugate_16ic_q15(
+    ComplexInt16* output,
+    const ComplexInt16* input0,
+    const ComplexInt16* input1,
+    unsigned int num_points)
+{
+    unsigned int number = 0;
+
+#ifdef __SSE2__
+    for(; (number + 4) <= num_points; number += 4)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input0 + number));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input1 + number));
+
+        // a*conj(b) = (ar*br + ai*bi) + i(ai*br - ar*bi)
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + number),
+            packQ15(maddSaturated(a, b), mdiff(swapParts(a), b)));
+    }
+#endif
+
+    for(; number < num_points; ++number)
+    {
+        const int64_t ar = input0[number].real();
+        const int64_t ai = input0[number].imag();
+        const int64_t br = input1[number].real();
+        const int64_t bi = input1[number].imag();
+
+        output[number] = ComplexInt16(
+            roundQ15((ar * br) + (ai * bi)),
+            roundQ15((ai * br) - (ar * bi)));
+    }
+}
+
+static void multiply_scalar_16ic_q15(
+    ComplexInt16* output,
+    const ComplexInt16* input,
+    const std::complex<float> scalar,
+    unsigned int num_points)
+{
+    const int16_t scalarReal = toQ15(scalar.real());
+    const int16_t scalarImag = toQ15(scalar.imag());
+
+    unsigned int number = 0;
+
+#ifdef __SSE2__
+    const __m128i scalarVec = _mm_set1_epi32(int32_t(uint16_t(scalarReal) | (uint32_t(uint16_t(scalarImag)) << 16)));
+    const __m128i scalarSwapped = swapParts(scalarVec);
+
+    for(; (number + 4) <= num_points; number += 4)
+    {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + number));
+
+        // a*s = (ar*sr - ai*si) + i(ar*si + ai*sr)
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(output + number),
+            packQ15(mdiff(a, scalarVec), maddSaturated(a, scalarSwapped)));
+    }
+#endif
+
+    for(; number < num_points; ++number)
+    {
+        const int64_t ar = input[number].real();
+        const int64_t ai = input[number].imag();
+
+        output[number] = ComplexInt16(
+            roundQ15((ar * scalarReal) - (ai * scalarImag)),
+            roundQ15((ar * scalarImag) + (ai * scalarReal)));
+    }
+}
+
+/***********************************************************************
+ * |PothosDoc Add (Saturating) (VOLK)
+ *
+ * <p>
+ * Adds two complex int16 streams, saturating each part to the int16
+ * range instead of wrapping.
+ * </p>
+ *
+ * <p>
+ * VOLK has no equivalent kernel, so this uses SSE2 when available.
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math plus fixed saturate cs16
+ *
+ * |factory /volk/add_cint16()
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKAddCInt16(
+    "/volk/add_cint16",
+    Pothos::Callable(TwoToOneBlock<ComplexInt16,ComplexInt16,ComplexInt16,size_t>::make)
+        .bind(&add_16ic_saturated, 0)
+        .bind(0, 1)
+        .bind(1, 2));
+
+/***********************************************************************
+ * |PothosDoc Subtract (Saturating) (VOLK)
+ *
+ * <p>
+ * Subtracts the second complex int16 stream from the first, saturating
+ * each part to the int16 range instead of wrapping.
+ * </p>
+ *
+ * <p>
+ * VOLK has no equivalent kernel, so this uses SSE2 when available.
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math minus fixed saturate cs16
+ *
+ * |factory /volk/subtract_cint16()
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKSubtractCInt16(
+    "/volk/subtract_cint16",
+    Pothos::Callable(TwoToOneBlock<ComplexInt16,ComplexInt16,ComplexInt16,size_t>::make)
+        .bind(&subtract_16ic_saturated, 0)
+        .bind(0, 1)
+        .bind(1, 2));
+
+/***********************************************************************
+ * |PothosDoc Conjugate (Saturating) (VOLK)
+ *
+ * <p>
+ * Conjugates a complex int16 stream. An imaginary part of -32768
+ * saturates to 32767.
+ * </p>
+ *
+ * <p>
+ * VOLK has no equivalent kernel, so this uses SSE2 when available.
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math fixed saturate cs16
+ *
+ * |factory /volk/conjugate_cint16()
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKConjugateCInt16(
+    "/volk/conjugate_cint16",
+    Pothos::Callable(OneToOneBlock<ComplexInt16,ComplexInt16>::make)
+        .bind(&conjugate_16ic_saturated, 0));
+
+/***********************************************************************
+ * |PothosDoc Multiply Conjugate (Q15) (VOLK)
+ *
+ * <p>
+ * Multiplies the first complex int16 stream by the conjugate of the
+ * second, treating each as Q15 fixed point. Each product is rounded
+ * back to Q15 and saturated to the int16 range.
+ * </p>
+ *
+ * <p>
+ * VOLK has no equivalent kernel, so this uses SSE2 when available.
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math fixed saturate q15 cs16
+ *
+ * |factory /volk/multiply_conjugate_cint16()
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKMultiplyConjugateCInt16(
+    "/volk/multiply_conjugate_cint16",
+    Pothos::Callable(TwoToOneBlock<ComplexInt16,ComplexInt16,ComplexInt16,size_t>::make)
+        .bind(&multiply_conjugate_16ic_q15, 0)
+        .bind(0, 1)
+        .bind(1, 2));
+
+/***********************************************************************
+ * |PothosDoc Multiply Scalar (Q15) (VOLK)
+ *
+ * <p>
+ * Multiplies a complex int16 stream, treated as Q15 fixed point, by a
+ * complex scalar. The scalar is converted to Q15, so its parts must be
+ * in the range [-1,1), and each product is rounded back to Q15 and
+ * saturated to the int16 range.
+ * </p>
+ *
+ * <p>
+ * VOLK has no equivalent kernel, so this uses SSE2 when available.
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math fixed saturate q15 cs16 gain
+ *
+ * |param scalar[Scalar]
+ * |widget LineEdit()
+ * |default 0.5
+ * |preview enable
+ *
+ * |factory /volk/multiply_scalar_cint16()
+ * |setter setScalar(scalar)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKMultiplyScalarCInt16(
+    "/volk/multiply_scalar_cint16",
+    Pothos::Callable(OneToOneScalarParamBlock<ComplexInt16,ComplexInt16,std::complex<float>>::make)
+        .bind(&multiply_scalar_16ic_q15, 0)
+        .bind("scalar", 1)
+        .bind("setScalar", 2));
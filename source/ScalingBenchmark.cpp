@@ -0,0 +1,301 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include <Pothos/Exception.hpp>
+#include <Pothos/Framework.hpp>
+#include <Pothos/Object/Containers.hpp>
+#include <Pothos/Plugin.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+// Benchmark blocks
+//
+
+// Produces as many elements as the downstream buffers allow, counting
+// them. Outputs are written with a fixed byte pattern, which is finite
+// and non-zero for every numeric type, so the source's memory traffic
+// is part of the measurement, as a real source's would be.
+class BenchmarkSource: public Pothos::Block
+{
+    public:
+        using Class = BenchmarkSource;
+
+        static Pothos::Block* make(const Pothos::DType& dtype)
+        {
+            return new Class(dtype);
+        }
+
+        BenchmarkSource(const Pothos::DType& dtype):
+            _count(0)
+        {
+            this->setupOutput(0, dtype);
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, count));
+        }
+
+        unsigned long long count() const
+        {
+            return _count;
+        }
+
+        void work() override
+        {
+            auto output = this->output(0);
+
+            const auto elems = output->elements();
+            if(0 == elems) return;
+
+            std::memset(output->buffer().as<void*>(), 0x3F, elems * output->dtype().size());
+            output->produce(elems);
+            _count += elems;
+        }
+
+    private:
+        std::atomic<unsigned long long> _count;
+};
+
+// Consumes everything, regardless of type.
+class BenchmarkSink: public Pothos::Block
+{
+    public:
+        static Pothos::Block* make()
+        {
+            return new BenchmarkSink();
+        }
+
+        BenchmarkSink()
+        {
+            this->setupInput(0);
+        }
+
+        void work() override
+        {
+            auto input = this->input(0);
+            input->consume(input->elements());
+        }
+};
+
+static Pothos::BlockRegistry registerVOLKBenchmarkSource(
+    "/volk/benchmark/source",
+    &BenchmarkSource::make);
+
+static Pothos::BlockRegistry registerVOLKBenchmarkSink(
+    "/volk/benchmark/sink",
+    &BenchmarkSink::make);
+
+//
+// Chains
+//
+
+// Each block is given as its path, optionally followed by its factory's
+// arguments as strings, such as "/volk/convert(int16,float32)".
+static Pothos::Proxy makeChainBlock(const std::string& blockSpec)
+{
+    const auto argsStart = blockSpec.find('(');
+    const auto path = blockSpec.substr(0, argsStart);
+
+    std::vector<std::string> args;
+    if(argsStart != std::string::npos)
+    {
+        if(blockSpec.back() != ')') throw Pothos::InvalidArgumentException("Invalid block: " + blockSpec);
+
+        const auto argsStr = blockSpec.substr(argsStart + 1, blockSpec.size() - argsStart - 2);
+        size_t argStart = 0;
+        while(!argsStr.empty() && (argStart <= argsStr.size()))
+        {
+            const auto argEnd = std::min(argsStr.find(',', argStart), argsStr.size());
+            args.emplace_back(argsStr.substr(argStart, argEnd - argStart));
+            argStart = argEnd + 1;
+        }
+    }
+
+    switch(args.size())
+    {
+        case 0: return Pothos::BlockRegistry::make(path);
+        case 1: return Pothos::BlockRegistry::make(path, args[0]);
+        case 2: return Pothos::BlockRegistry::make(path, args[0], args[1]);
+        case 3: return Pothos::BlockRegistry::make(path, args[0], args[1], args[2]);
+        default: throw Pothos::InvalidArgumentException("Too many arguments: " + blockSpec);
+    }
+}
+
+struct Chain
+{
+    Pothos::Proxy source;
+    std::vector<Pothos::Proxy> blocks;
+    Pothos::Proxy sink;
+};
+
+// Each block's first output feeds every stream input of the next, so
+// two-input blocks like /volk/multiply_conjugate fit in a chain. Only
+// this module's blocks can use VOLK's buffer allocator, so the setting
+// is only applied to them.
+static Chain makeChain(
+    Pothos::Topology& topology,
+    const Pothos::DType& sourceDType,
+    const std::vector<std::string>& blockSpecs,
+    bool volkBufferAllocator)
+{
+    Chain chain;
+    chain.source = Pothos::BlockRegistry::make("/volk/benchmark/source", sourceDType);
+    chain.sink = Pothos::BlockRegistry::make("/volk/benchmark/sink");
+
+    Pothos::Proxy upstream = chain.source;
+    for(const auto& blockSpec: blockSpecs)
+    {
+        auto block = makeChainBlock(blockSpec);
+#ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+        if(0 == blockSpec.find("/volk/")) block.call("setVOLKBufferAllocatorEnabled", volkBufferAllocator);
+#else
+        (void)volkBufferAllocator;
+#endif
+        for(const auto& portInfo: block.call<std::vector<Pothos::PortInfo>>("inputPortInfo"))
+        {
+            if(!portInfo.isSigSlot) topology.connect(upstream, 0, block, portInfo.name);
+        }
+
+        chain.blocks.emplace_back(block);
+        upstream = block;
+    }
+    topology.connect(upstream, 0, chain.sink, 0);
+
+    return chain;
+}
+
+//
+// Measurement
+//
+
+// Runs numChains copies of the chain at once, returning the number of
+// source elements each processed per second.
+static std::vector<double> measureChains(
+    const Pothos::DType& sourceDType,
+    const std::vector<std::string>& blockSpecs,
+    bool volkBufferAllocator,
+    size_t numChains,
+    double seconds)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // Lets the chains reach a steady state before measuring.
+    constexpr double WarmupSeconds = 0.2;
+
+    Pothos::Topology topology;
+
+    std::vector<Chain> chains;
+    for(size_t i = 0; i < numChains; ++i) chains.emplace_back(makeChain(topology, sourceDType, blockSpecs, volkBufferAllocator));
+
+    topology.commit();
+    std::this_thread::sleep_for(std::chrono::duration<double>(WarmupSeconds));
+
+    std::vector<unsigned long long> startCounts;
+    for(const auto& chain: chains) startCounts.emplace_back(chain.source.call<unsigned long long>("count"));
+    const auto start = Clock::now();
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(seconds));
+
+    std::vector<unsigned long long> endCounts;
+    for(const auto& chain: chains) endCounts.emplace_back(chain.source.call<unsigned long long>("count"));
+    const std::chrono::duration<double> elapsed = Clock::now() - start;
+
+    topology.disconnectAll();
+    topology.commit();
+
+    std::vector<double> rates;
+    for(size_t i = 0; i < numChains; ++i)
+    {
+        rates.emplace_back(double(endCounts[i] - startCounts[i]) / elapsed.count());
+    }
+
+    return rates;
+}
+
+static Pothos::ObjectVector measureScaling(
+    const Pothos::DType& sourceDType,
+    const std::vector<std::string>& blockSpecs,
+    bool volkBufferAllocator,
+    size_t maxChains,
+    double seconds)
+{
+    Pothos::ObjectVector results;
+
+    double singleChainRate = 0.0;
+    for(size_t numChains = 1; numChains <= maxChains; ++numChains)
+    {
+        const auto rates = measureChains(sourceDType, blockSpecs, volkBufferAllocator, numChains, seconds);
+
+        double aggregateRate = 0.0;
+        for(const auto rate: rates) aggregateRate += rate;
+        if(1 == numChains) singleChainRate = aggregateRate;
+
+        // Relative to numChains times the throughput of one chain alone
+        const double efficiency = (singleChainRate > 0.0) ? (aggregateRate / (double(numChains) * singleChainRate)) : 0.0;
+
+        Pothos::ObjectKwargs result;
+        result["numChains"] = Pothos::Object(numChains);
+        result["aggregateElementsPerSecond"] = Pothos::Object(aggregateRate);
+        result["aggregateBytesPerSecond"] = Pothos::Object(aggregateRate * double(sourceDType.size()));
+        result["perChainElementsPerSecond"] = Pothos::Object(aggregateRate / double(numChains));
+        result["minChainElementsPerSecond"] = Pothos::Object(*std::min_element(rates.begin(), rates.end()));
+        result["efficiency"] = Pothos::Object(efficiency);
+        results.emplace_back(result);
+    }
+
+    return results;
+}
+
+//
+// Plugin
+//
+
+// Runs 1 to maxChains independent copies of the given chain of blocks,
+// each fed by a source of sourceDType, for the given number of seconds.
+// maxChains defaults to the number of CPUs if zero. For each number of
+// chains, returns the aggregate and per-chain throughput in source
+// elements, and the scaling efficiency. This is repeated with VOLK's
+// shared buffer allocator, if this build uses it, and with the
+// framework's default buffers.
+static Pothos::ObjectKwargs benchmarkVOLKScaling(
+    const std::string& sourceDType,
+    const std::vector<std::string>& blockSpecs,
+    size_t maxChains,
+    double seconds)
+{
+    if(blockSpecs.empty()) throw Pothos::InvalidArgumentException("The chain must have at least one block.");
+    if(seconds <= 0.0) throw Pothos::InvalidArgumentException("The measurement time must be positive.");
+
+    const Pothos::DType dtype(sourceDType);
+    if(0 == maxChains) maxChains = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    Pothos::ObjectKwargs allocatorResults;
+#ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+    allocatorResults["volk"] = Pothos::Object(measureScaling(dtype, blockSpecs, true, maxChains, seconds));
+#endif
+    allocatorResults["default"] = Pothos::Object(measureScaling(dtype, blockSpecs, false, maxChains, seconds));
+
+    Pothos::ObjectKwargs report;
+    report["machine"] = Pothos::Object(std::string(volk_get_machine()));
+    report["numCPUs"] = Pothos::Object(size_t(std::thread::hardware_concurrency()));
+    report["sourceDType"] = Pothos::Object(dtype.name());
+    report["chain"] = Pothos::Object(blockSpecs);
+    report["seconds"] = Pothos::Object(seconds);
+    report["allocators"] = Pothos::Object(allocatorResults);
+
+    return report;
+}
+
+pothos_static_block(pothosVOLKRegisterScalingBenchmark)
+{
+    Pothos::PluginRegistry::addCall(
+        "/volk/benchmark_scaling",
+        &benchmarkVOLKScaling);
+}
@@ -0,0 +1,367 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+//
+// Interface
+//
+
+class SpectralNoiseFloor: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        SpectralNoiseFloor();
+        virtual ~SpectralNoiseFloor() = default;
+
+        float spectralExclusionValue() const
+        {
+            return _spectralExclusionValue;
+        }
+
+        void setSpectralExclusionValue(float spectralExclusionValue)
+        {
+            _spectralExclusionValue = spectralExclusionValue;
+        }
+
+        size_t frameSize() const
+        {
+            return _frameSize;
+        }
+
+        void setFrameSize(size_t frameSize);
+
+        float alpha() const
+        {
+            return _alpha;
+        }
+
+        void setAlpha(float alpha);
+
+        bool cfarEnabled() const
+        {
+            return _cfarEnabled;
+        }
+
+        void setCFAREnabled(bool cfarEnabled)
+        {
+            _cfarEnabled = cfarEnabled;
+        }
+
+        float cfarMargin() const
+        {
+            return _cfarMargin;
+        }
+
+        void setCFARMargin(float cfarMargin)
+        {
+            _cfarMargin = cfarMargin;
+        }
+
+        float noiseFloor() const
+        {
+            return _noiseFloor;
+        }
+
+        void reset();
+
+        void work() override;
+
+        void propagateLabels(const Pothos::InputPort* input) override;
+
+    private:
+        float _spectralExclusionValue;
+        size_t _frameSize;
+        float _alpha;
+        bool _cfarEnabled;
+        float _cfarMargin;
+
+        float _noiseFloor;
+        bool _noiseFloorValid;
+
+        std::vector<float> _thresholdDiffs;
+        std::vector<int8_t> _detections;
+        std::vector<uint32_t> _detectionIndices;
+
+        void _detect(const float* frame);
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* SpectralNoiseFloor::make()
+{
+    return new SpectralNoiseFloor();
+}
+
+SpectralNoiseFloor::SpectralNoiseFloor():
+    VOLKBlock(),
+    _spectralExclusionValue(20.0f),
+    _frameSize(1024),
+    _alpha(1.0f),
+    _cfarEnabled(false),
+    _cfarMargin(10.0f),
+    _noiseFloor(0.0f),
+    _noiseFloorValid(false)
+{
+    this->setupInput(0, "float32");
+    this->setupOutput(0, "float32");
+    this->setupOutput("detections");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, spectralExclusionValue));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, setSpectralExclusionValue));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, frameSize));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, setFrameSize));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, alpha));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, setAlpha));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, cfarEnabled));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, setCFAREnabled));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, cfarMargin));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, setCFARMargin));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, noiseFloor));
+    this->registerProbe("noiseFloor");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SpectralNoiseFloor, reset));
+
+    this->_registerSetterLabel(
+        "setSpectralExclusionValue",
+        [this](const Pothos::Object& value)
+        {
+            this->setSpectralExclusionValue(value.convert<float>());
+        });
+
+    // Explicitly call to size the internal buffers and input reserve.
+    this->setFrameSize(_frameSize);
+}
+
+void SpectralNoiseFloor::setFrameSize(size_t frameSize)
+{
+    if(0 == frameSize) throw Pothos::InvalidArgumentException("Frame size must be non-zero.");
+
+    _frameSize = frameSize;
+    _thresholdDiffs.resize(_frameSize);
+    _detections.resize(_frameSize);
+    _detectionIndices.resize(_frameSize);
+
+    this->input(0)->setReserve(_frameSize);
+    this->reset();
+}
+
+void SpectralNoiseFloor::setAlpha(float alpha)
+{
+    if((alpha <= 0.0f) || (alpha > 1.0f))
+    {
+        throw Pothos::RangeException("Alpha must be in the range (0,1].");
+    }
+
+    _alpha = alpha;
+}
+
+void SpectralNoiseFloor::reset()
+{
+    _noiseFloor = 0.0f;
+    _noiseFloorValid = false;
+}
+
+void SpectralNoiseFloor::work()
+{
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const auto numFrames = std::min(
+        input->elements() / _frameSize,
+        output->elements());
+    if(0 == numFrames) return;
+
+    const float* inputBuffer = input->buffer();
+    float* outputBuffer = output->buffer();
+
+    for(size_t frame = 0; frame < numFrames; ++frame)
+    {
+        // Setter labels apply from the start of their frame.
+        const auto frameOffset = frame * _frameSize;
+        this->_applySetterLabels(input, frameOffset, frameOffset + _frameSize);
+
+        const float* framePtr = inputBuffer + frameOffset;
+
+        float frameNoiseFloor = 0.0f;
+        volk_32f_s32f_calc_spectral_noise_floor_32f(
+            &frameNoiseFloor,
+            framePtr,
+            _spectralExclusionValue,
+            static_cast<unsigned int>(_frameSize));
+
+        if(_noiseFloorValid)
+        {
+            _noiseFloor = (_alpha * frameNoiseFloor) + ((1.0f - _alpha) * _noiseFloor);
+        }
+        else
+        {
+            _noiseFloor = frameNoiseFloor;
+            _noiseFloorValid = true;
+        }
+
+        outputBuffer[frame] = _noiseFloor;
+
+        if(_cfarEnabled) this->_detect(framePtr);
+    }
+
+    input->consume(numFrames * _frameSize);
+    output->produce(numFrames);
+}
+
+void SpectralNoiseFloor::propagateLabels(const Pothos::InputPort* input)
+{
+    auto output = this->output(0);
+    for(const auto& label: input->labels())
+    {
+        if(this->_isSetterLabel(label)) continue;
+        output->postLabel(label.toAdjusted(1, _frameSize));
+    }
+}
+
+// Post a packet with the indices of all bins above the threshold.
+void SpectralNoiseFloor::_detect(const float* frame)
+{
+    const auto frameSize = static_cast<unsigned int>(_frameSize);
+    const float threshold = _noiseFloor + _cfarMargin;
+
+    // Shift the frame so the binary slicer marks values at or above
+    // the threshold.
+    volk_32f_s32f_add_32f(
+        _thresholdDiffs.data(),
+        frame,
+        -threshold,
+        frameSize);
+    volk_32f_binary_slicer_8i(
+        _detections.data(),
+        _thresholdDiffs.data(),
+        frameSize);
+
+    size_t numDetections = 0;
+    for(size_t bin = 0; bin < _frameSize; ++bin)
+    {
+        if(_detections[bin]) _detectionIndices[numDetections++] = uint32_t(bin);
+    }
+    if(0 == numDetections) return;
+
+    Pothos::Packet packet;
+    packet.payload = Pothos::BufferChunk("uint32", numDetections);
+    std::copy(
+        _detectionIndices.begin(),
+        _detectionIndices.begin() + numDetections,
+        packet.payload.as<uint32_t*>());
+    packet.metadata["noiseFloor"] = Pothos::Object(_noiseFloor);
+    packet.metadata["threshold"] = Pothos::Object(threshold);
+
+    this->output("detections")->postMessage(std::move(packet));
+}
+
+/***********************************************************************
+ * |PothosDoc Calc Spectral Noise Floor (VOLK)
+ *
+ * <p>
+ * Computes the spectral noise floor of each frame of an input power
+ * spectrum.
+ * </p>
+ *
+ * <p>
+ * Calculates the spectral noise floor of an input power spectrum by
+ * determining the mean of the input power spectrum, then
+ * recalculating the mean excluding any power spectrum values that
+ * exceed the mean by the <b>spectralExclusionValue</b> (in dB).  Provides a
+ * rough estimation of the signal noise floor.
+ * </p>
+ *
+ * <p>
+ * The spectral exclusion value can also be set by input labels with the
+ * ID <b>setSpectralExclusionValue</b>, which take effect at the start of
+ * the labeled frame.
+ * </p>
+ *
+ * <p>
+ * Outputs one noise floor value (in dB) per <b>frameSize</b> inputs,
+ * exponentially tracked across frames with the given <b>alpha</b>.
+ * </p>
+ *
+ * <p>
+ * If CFAR detection is enabled, the block posts a packet on the
+ * <b>detections</b> port for each frame with bins exceeding the noise
+ * floor by at least <b>cfarMargin</b>. The payload contains the
+ * <b>uint32</b> indices of these bins, and the metadata contains the
+ * <b>noiseFloor</b> and <b>threshold</b> used.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_s32f_calc_spectral_noise_floor_32f</b></li>
+ * <li><b>volk_32f_s32f_add_32f</b> (CFAR)</li>
+ * <li><b>volk_32f_binary_slicer_8i</b> (CFAR)</li>
+ * </ul>
+ *
+ * |category /VOLK
+ * |keywords rf spectrum cfar detect
+ *
+ * |param spectralExclusionValue[Spectral Exclusion Value]
+ * The number of dB above the noise floor that a data point must be to be
+ * excluded from the noise floor calculation.
+ * |widget DoubleSpinBox(decimals=3)
+ * |units dB
+ * |default 20.0
+ * |preview enable
+ *
+ * |param frameSize[Frame Size]
+ * The number of spectrum bins in each frame.
+ * |widget SpinBox(minimum=1)
+ * |default 1024
+ * |preview enable
+ *
+ * |param alpha[Alpha]
+ * The weight of each new frame's noise floor. A value of <b>1.0</b>
+ * disables tracking.
+ * |widget DoubleSpinBox(minimum=0,maximum=1,step=0.01,decimals=3)
+ * |default 1.0
+ * |preview valid
+ *
+ * |param cfarEnabled[CFAR Enabled]
+ * |widget ToggleSwitch(on="True", off="False")
+ * |default false
+ * |preview valid
+ *
+ * |param cfarMargin[CFAR Margin]
+ * The number of dB above the noise floor that a bin must be to be
+ * reported as a detection.
+ * |widget DoubleSpinBox(decimals=3)
+ * |units dB
+ * |default 10.0
+ * |preview valid
+ *
+ * |factory /volk/calc_spectral_noise_floor()
+ * |setter setSpectralExclusionValue(spectralExclusionValue)
+ * |setter setFrameSize(frameSize)
+ * |setter setAlpha(alpha)
+ * |setter setCFAREnabled(cfarEnabled)
+ * |setter setCFARMargin(cfarMargin)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKCalcSpectralNoiseFloor(
+    "/volk/calc_spectral_noise_floor",
+    &SpectralNoiseFloor::make);
@@ -48,11 +48,11 @@ class SquareDist: public VOLKBlock
         // This reduces branching in the work function and allows the
         // VOLK calls to potentially be inlined, which wouldn't work
         // in a capturing lambda.
-        using WorkFcn = void(SquareDist::*)(void);
+        using WorkFcn = void(SquareDist::*)(float*, const std::complex<float>*, size_t);
         WorkFcn _work;
 
-        void _workNoScalar();
-        void _workScalar();
+        void _workNoScalar(float* output, const std::complex<float>* input, size_t elems);
+        void _workScalar(float* output, const std::complex<float>* input, size_t elems);
 };
 
 //
@@ -78,6 +78,19 @@ SquareDist::SquareDist():
     this->registerCall(this, POTHOS_FCN_TUPLE(SquareDist, scalar));
     this->registerCall(this, POTHOS_FCN_TUPLE(SquareDist, setScalar));
 
+    this->_registerSetterLabel(
+        "setComplexInput",
+        [this](const Pothos::Object& value)
+        {
+            this->setComplexInput(value.convert<std::complex<float>>());
+        });
+    this->_registerSetterLabel(
+        "setScalar",
+        [this](const Pothos::Object& value)
+        {
+            this->setScalar(value.convert<float>());
+        });
+
     // Explicitly call to set the work function.
     this->setScalar(1.0f);
 }
@@ -94,44 +107,58 @@ void SquareDist::setScalar(float scalar)
 void SquareDist::work()
 {
     assert(_work);
-    std::mem_fn(_work)(this);
-}
 
-void SquareDist::_workNoScalar()
-{
     const auto elems = this->workInfo().minElements;
     if(0 == elems) return;
 
     auto input = this->input(0);
     auto output = this->output(0);
 
-    volk_32fc_x2_square_dist_32f(
-        output->buffer(),
-        &_input,
-        input->buffer(),
-        static_cast<unsigned int>(elems));
+    float* outputBuffer = output->buffer();
+    const std::complex<float>* inputBuffer = input->buffer();
+
+    // Setter labels can change the work function, so it's looked up for
+    // each span.
+    for(size_t offset = 0; offset < elems;)
+    {
+        const auto spanElems = this->_setterLabelSpan(input, offset, elems);
+
+        std::mem_fn(_work)(
+            this,
+            outputBuffer + offset,
+            inputBuffer + offset,
+            spanElems);
+
+        offset += spanElems;
+    }
 
     input->consume(elems);
     output->produce(elems);
 }
 
-void SquareDist::_workScalar()
+void SquareDist::_workNoScalar(
+    float* output,
+    const std::complex<float>* input,
+    size_t elems)
 {
-    const auto elems = this->workInfo().minElements;
-    if(0 == elems) return;
-
-    auto input = this->input(0);
-    auto output = this->output(0);
+    volk_32fc_x2_square_dist_32f(
+        output,
+        &_input,
+        input,
+        static_cast<unsigned int>(elems));
+}
 
+void SquareDist::_workScalar(
+    float* output,
+    const std::complex<float>* input,
+    size_t elems)
+{
     volk_32fc_x2_s32f_square_dist_scalar_mult_32f(
-        output->buffer(),
+        output,
         &_input,
-        input->buffer(),
+        input,
         _scalar,
         static_cast<unsigned int>(elems));
-
-    input->consume(elems);
-    output->produce(elems);
 }
 
 /***********************************************************************
@@ -148,6 +175,12 @@ void SquareDist::_workScalar()
  * <li><b>volk_32fc_x2_s32f_square_dist_scalar_mult_32f</b></li>
  * </ul>
  *
+ * <p>
+ * Both parameters can also be set by input labels with the IDs
+ * <b>setComplexInput</b> and <b>setScalar</b>, which take effect at
+ * the labeled sample.
+ * </p>
+ *
  * |category /Math/VOLK
  * |category /VOLK/Math
  * |keywords math complex
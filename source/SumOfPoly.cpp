@@ -0,0 +1,196 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <Poco/Format.h>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <vector>
+
+// The VOLK kernel always evaluates a fourth-order polynomial.
+static constexpr size_t NumCoefficients = 5;
+
+//
+// Interface
+//
+
+class SumOfPoly: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        SumOfPoly();
+        virtual ~SumOfPoly() = default;
+
+        size_t frameSize() const
+        {
+            return _frameSize;
+        }
+
+        void setFrameSize(size_t frameSize);
+
+        std::vector<float> coefficients() const
+        {
+            return _coefficients;
+        }
+
+        void setCoefficients(const std::vector<float>& coefficients);
+
+        float cutoff() const
+        {
+            return _cutoff;
+        }
+
+        void setCutoff(float cutoff)
+        {
+            _cutoff = cutoff;
+        }
+
+        void work() override;
+
+        void propagateLabels(const Pothos::InputPort* input) override;
+
+    private:
+        size_t _frameSize;
+        std::vector<float> _coefficients;
+        float _cutoff;
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* SumOfPoly::make()
+{
+    return new SumOfPoly();
+}
+
+SumOfPoly::SumOfPoly():
+    VOLKBlock(),
+    _frameSize(1),
+    _coefficients({1.0f, 0.0f, 0.0f, 0.0f, 0.0f}),
+    _cutoff(-1e10f)
+{
+    this->setupInput(0, "float32");
+    this->setupOutput(0, "float32");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SumOfPoly, frameSize));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SumOfPoly, setFrameSize));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SumOfPoly, coefficients));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SumOfPoly, setCoefficients));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(SumOfPoly, cutoff));
+    this->registerCall(this, POTHOS_FCN_TUPLE(SumOfPoly, setCutoff));
+}
+
+void SumOfPoly::setFrameSize(size_t frameSize)
+{
+    if(0 == frameSize) throw Pothos::InvalidArgumentException("Frame size must be non-zero.");
+
+    _frameSize = frameSize;
+    this->input(0)->setReserve(_frameSize);
+}
+
+void SumOfPoly::setCoefficients(const std::vector<float>& coefficients)
+{
+    if(coefficients.size() != NumCoefficients)
+    {
+        throw Pothos::InvalidArgumentException(Poco::format(
+            "Expected %z coefficients, got %z.",
+            NumCoefficients,
+            coefficients.size()));
+    }
+
+    _coefficients = coefficients;
+}
+
+void SumOfPoly::work()
+{
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const auto numFrames = std::min(
+        input->elements() / _frameSize,
+        output->elements());
+    if(0 == numFrames) return;
+
+    // The VOLK kernel takes non-const pointers but doesn't modify them.
+    auto* inputBuffer = input->buffer().as<float*>();
+    float* outputBuffer = output->buffer();
+
+    for(size_t frame = 0; frame < numFrames; ++frame)
+    {
+        volk_32f_x3_sum_of_poly_32f(
+            &outputBuffer[frame],
+            inputBuffer + (frame * _frameSize),
+            _coefficients.data(),
+            &_cutoff,
+            static_cast<unsigned int>(_frameSize));
+    }
+
+    input->consume(numFrames * _frameSize);
+    output->produce(numFrames);
+}
+
+void SumOfPoly::propagateLabels(const Pothos::InputPort* input)
+{
+    auto output = this->output(0);
+    for(const auto& label: input->labels())
+    {
+        output->postLabel(label.toAdjusted(1, _frameSize));
+    }
+}
+
+/***********************************************************************
+ * |PothosDoc Sum of Polynomial (VOLK)
+ *
+ * <p>
+ * For each frame of <b>frameSize</b> inputs, outputs the sum of a
+ * fourth-order polynomial evaluated at each input. Inputs below the
+ * <b>cutoff</b> are clamped to it before evaluation.
+ * </p>
+ *
+ * <p>
+ * For coefficients <b>[c0,c1,c2,c3,c4]</b>, each input <b>x</b>
+ * contributes <b>c0*x + c1*x^2 + c2*x^3 + c3*x^4 + c4</b>.
+ * </p>
+ *
+ * <p>
+ * Underlying function: <b>volk_32f_x3_sum_of_poly_32f</b>
+ * </p>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math polynomial
+ *
+ * |param frameSize[Frame Size]
+ * The number of inputs summed into each output.
+ * |widget SpinBox(minimum=1)
+ * |default 1
+ * |preview enable
+ *
+ * |param coefficients[Coefficients]
+ * |widget LineEdit()
+ * |default [1.0, 0.0, 0.0, 0.0, 0.0]
+ * |preview enable
+ *
+ * |param cutoff[Cutoff]
+ * The minimum value of each input.
+ * |widget DoubleSpinBox(decimals=3)
+ * |default -1e10
+ * |preview enable
+ *
+ * |factory /volk/sum_of_poly()
+ * |setter setFrameSize(frameSize)
+ * |setter setCoefficients(coefficients)
+ * |setter setCutoff(cutoff)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKSumOfPoly(
+    "/volk/sum_of_poly",
+    &SumOfPoly::make);
@@ -0,0 +1,334 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Fallback.hpp"
+#include "ToDBKernels.hpp"
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Converts log2 to dB (10*log10(x) = (10/log2(10))*log2(x))
+static const float Log2ToDBFactor = 10.0f / std::log2(10.0f);
+
+//
+// Interface
+//
+
+class ToDB: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make(const Pothos::DType& dtype);
+
+        ToDB(const Pothos::DType& dtype);
+        virtual ~ToDB() = default;
+
+        std::string mode() const
+        {
+            return _amplitude ? "AMPLITUDE" : "POWER";
+        }
+
+        void setMode(const std::string& mode);
+
+        std::string precision() const
+        {
+            return _fastLog ? "FAST" : "PRECISE";
+        }
+
+        void setPrecision(const std::string& precision);
+
+        bool floorEnabled() const
+        {
+            return _floorEnabled;
+        }
+
+        void setFloorEnabled(bool floorEnabled)
+        {
+            _floorEnabled = floorEnabled;
+        }
+
+        float floor() const
+        {
+            return _floor;
+        }
+
+        void setFloor(float floor);
+
+        void work() override;
+
+    private:
+        bool _complex;
+        bool _amplitude;
+        bool _fastLog;
+        bool _floorEnabled;
+        float _floor;
+
+        // The floor converted back to a linear power
+        float _linearFloor;
+
+        std::vector<float> _tile;
+
+        // Each function returns the linear power values of the tile,
+        // which may be the input itself.
+        using PowerFcn = const float*(ToDB::*)(const Pothos::BufferChunk&, size_t, size_t);
+        PowerFcn _power;
+
+        const float* _complexPower(const Pothos::BufferChunk& input, size_t offset, size_t elems);
+        const float* _realPower(const Pothos::BufferChunk& input, size_t offset, size_t elems);
+        const float* _realAmplitude(const Pothos::BufferChunk& input, size_t offset, size_t elems);
+
+        void _updatePowerFcn();
+};
+
+//
+// Implementation
+//
+
+static const std::string VOLKToDBPath = "/volk/to_db";
+
+Pothos::Block* ToDB::make(const Pothos::DType& dtype)
+{
+    return new ToDB(dtype);
+}
+
+ToDB::ToDB(const Pothos::DType& dtype):
+    VOLKBlock(),
+    _complex(false),
+    _amplitude(true),
+    _fastLog(false),
+    _floorEnabled(false),
+    _floor(-120.0f),
+    _linearFloor(0.0f),
+    _tile(TileElems),
+    _power(nullptr)
+{
+    if(doesDTypeMatch<std::complex<float>>(dtype)) _complex = true;
+    else if(!doesDTypeMatch<float>(dtype)) throw InvalidDTypeException(VOLKToDBPath, dtype);
+
+    this->setupInput(0, dtype);
+    this->setupOutput(0, "float32");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, mode));
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, setMode));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, precision));
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, setPrecision));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, floorEnabled));
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, setFloorEnabled));
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, floor));
+    this->registerCall(this, POTHOS_FCN_TUPLE(ToDB, setFloor));
+
+    // Explicitly call to set the work function and linear floor.
+    this->_updatePowerFcn();
+    this->setFloor(_floor);
+}
+
+void ToDB::setMode(const std::string& mode)
+{
+    if(_complex)
+    {
+        if(mode != "AMPLITUDE") throw Pothos::InvalidArgumentException("Complex inputs are always amplitudes.");
+    }
+    else if(mode == "AMPLITUDE") _amplitude = true;
+    else if(mode == "POWER")     _amplitude = false;
+    else throw Pothos::InvalidArgumentException("Invalid mode: " + mode);
+
+    this->_updatePowerFcn();
+}
+
+void ToDB::setPrecision(const std::string& precision)
+{
+    if(precision == "PRECISE")   _fastLog = false;
+    else if(precision == "FAST") _fastLog = true;
+    else throw Pothos::InvalidArgumentException("Invalid precision: " + precision);
+}
+
+void ToDB::setFloor(float floor)
+{
+    _floor = floor;
+    _linearFloor = std::pow(10.0f, _floor / 10.0f);
+}
+
+void ToDB::work()
+{
+    assert(_power);
+
+    const auto elems = this->workInfo().minElements;
+    if(0 == elems) return;
+
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const auto& inputBuffer = input->buffer();
+    float* outputBuffer = output->buffer();
+
+    for(size_t offset = 0; offset < elems; offset += TileElems)
+    {
+        const auto tileElems = std::min(TileElems, elems - offset);
+        float* outputTile = outputBuffer + offset;
+
+        const float* linear = std::mem_fn(_power)(this, inputBuffer, offset, tileElems);
+
+        // Clamping the linear values also keeps zeros from becoming -inf.
+        if(_floorEnabled)
+        {
+            volk_32f_s32f_x2_clamp_32f(
+                _tile.data(),
+                linear,
+                _linearFloor,
+                std::numeric_limits<float>::max(),
+                static_cast<unsigned int>(tileElems));
+            linear = _tile.data();
+        }
+
+        if(_fastLog) ToDBKernels::fastLog2(outputTile, linear, static_cast<unsigned int>(tileElems));
+        else volk_32f_log2_32f(outputTile, linear, static_cast<unsigned int>(tileElems));
+
+        volk_32f_s32f_multiply_32f(
+            outputTile,
+            outputTile,
+            Log2ToDBFactor,
+            static_cast<unsigned int>(tileElems));
+    }
+
+    input->consume(elems);
+    output->produce(elems);
+}
+
+const float* ToDB::_complexPower(
+    const Pothos::BufferChunk& input,
+    size_t offset,
+    size_t elems)
+{
+    volk_32fc_magnitude_squared_32f(
+        _tile.data(),
+        input.as<const std::complex<float>*>() + offset,
+        static_cast<unsigned int>(elems));
+
+    return _tile.data();
+}
+
+const float* ToDB::_realPower(
+    const Pothos::BufferChunk& input,
+    size_t offset,
+    size_t)
+{
+    return input.as<const float*>() + offset;
+}
+
+// Squaring amplitudes gives the same result as 20*log10(|x|) with a
+// single log, and no special case for negative inputs.
+const float* ToDB::_realAmplitude(
+    const Pothos::BufferChunk& input,
+    size_t offset,
+    size_t elems)
+{
+    const float* inputTile = input.as<const float*>() + offset;
+
+    volk_32f_x2_multiply_32f(
+        _tile.data(),
+        inputTile,
+        inputTile,
+        static_cast<unsigned int>(elems));
+
+    return _tile.data();
+}
+
+void ToDB::_updatePowerFcn()
+{
+    if(_complex)         _power = &ToDB::_complexPower;
+    else if(_amplitude)  _power = &ToDB::_realAmplitude;
+    else                 _power = &ToDB::_realPower;
+}
+
+/***********************************************************************
+ * |PothosDoc To dB (VOLK)
+ *
+ * <p>
+ * Converts power or amplitude inputs to dB in a single pass, in
+ * cache-sized tiles. Power inputs are converted to <b>10*log10(x)</b>,
+ * and amplitude inputs to <b>20*log10(|x|)</b>. Complex inputs are
+ * always treated as amplitudes.
+ * </p>
+ *
+ * <p>
+ * If <b>floorEnabled</b> is set, outputs below <b>floor</b> are clamped
+ * to it, which also keeps zero inputs from outputting -inf.
+ * </p>
+ *
+ * <p>
+ * The <b>FAST</b> precision replaces <b>volk_32f_log2_32f</b> with a
+ * lower-order polynomial approximation, accurate to within about
+ * 0.0012 dB and vectorized for the fastest instruction set the CPU
+ * supports.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32fc_magnitude_squared_32f</b> (complex)</li>
+ * <li><b>volk_32f_x2_multiply_32f</b> (float amplitude)</li>
+ * <li><b>volk_32f_s32f_x2_clamp_32f</b> (floor)</li>
+ * <li><b>volk_32f_log2_32f</b> (precise)</li>
+ * <li><b>volk_32f_s32f_multiply_32f</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /VOLK/Math
+ * |keywords math log decibel power magnitude meter
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float32=1,cfloat32=1)
+ * |default "complex_float32"
+ * |preview disable
+ *
+ * |param mode[Mode]
+ * Only used for float32 inputs.
+ * |widget ComboBox(editable=false)
+ * |default "AMPLITUDE"
+ * |option [Power] "POWER"
+ * |option [Amplitude] "AMPLITUDE"
+ * |preview enable
+ *
+ * |param precision[Precision]
+ * |widget ComboBox(editable=false)
+ * |default "PRECISE"
+ * |option [Precise] "PRECISE"
+ * |option [Fast] "FAST"
+ * |preview enable
+ *
+ * |param floorEnabled[Floor Enabled]
+ * |widget ToggleSwitch(on="True", off="False")
+ * |default false
+ * |preview valid
+ *
+ * |param floor[Floor]
+ * |widget DoubleSpinBox(decimals=3)
+ * |units dB
+ * |default -120.0
+ * |preview valid
+ *
+ * |factory /volk/to_db(dtype)
+ * |setter setMode(mode)
+ * |setter setPrecision(precision)
+ * |setter setFloorEnabled(floorEnabled)
+ * |setter setFloor(floor)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKToDB(
+    VOLKToDBPath,
+    &ToDB::make);
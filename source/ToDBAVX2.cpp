@@ -0,0 +1,56 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ToDBKernels.hpp"
+
+#include <immintrin.h>
+
+// Requires AVX2 and FMA. As in FallbackSIMD.hpp, this file must not
+// instantiate any inline function or template with external linkage,
+// and tails use the generic implementations.
+
+namespace { namespace AVX2
+{
+    constexpr unsigned int Width = 8;
+
+    void fastLog2(float* output, const float* input, unsigned int num_points)
+    {
+        const auto exponentMask = _mm256_set1_epi32(0xFF);
+        const auto exponentBias = _mm256_set1_epi32(127);
+        const auto fractionMask = _mm256_set1_epi32(0x007FFFFF);
+        const auto oneBits = _mm256_set1_epi32(0x3F800000);
+        const auto one = _mm256_set1_ps(1.0f);
+
+        unsigned int number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto bits = _mm256_castps_si256(_mm256_loadu_ps(input + number));
+
+            const auto biased = _mm256_and_si256(_mm256_srli_epi32(bits, 23), exponentMask);
+            const auto exponent = _mm256_cvtepi32_ps(_mm256_sub_epi32(biased, exponentBias));
+
+            // Mantissa in [1,2)
+            const auto mantissa = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, fractionMask), oneBits));
+
+            auto poly = _mm256_set1_ps(ToDBKernels::FastLog2Poly[0]);
+            for(size_t i = 1; i < ToDBKernels::NumFastLog2Coeffs; ++i)
+            {
+                poly = _mm256_fmadd_ps(poly, mantissa, _mm256_set1_ps(ToDBKernels::FastLog2Poly[i]));
+            }
+
+            _mm256_storeu_ps(output + number, _mm256_fmadd_ps(poly, _mm256_sub_ps(mantissa, one), exponent));
+        }
+
+        ToDBKernels::Generic::fastLog2(output + number, input + number, num_points - number);
+    }
+}}
+
+const ToDBKernels::KernelTable& ToDBKernels::getAVX2KernelTable()
+{
+    static const KernelTable table =
+    {
+        &AVX2::fastLog2,
+    };
+
+    return table;
+}
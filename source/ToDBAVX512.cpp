@@ -0,0 +1,56 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ToDBKernels.hpp"
+
+#include <immintrin.h>
+
+// Requires AVX-512F. As in FallbackSIMD.hpp, this file must not
+// instantiate any inline function or template with external linkage,
+// and tails use the generic implementations.
+
+namespace { namespace AVX512
+{
+    constexpr unsigned int Width = 16;
+
+    void fastLog2(float* output, const float* input, unsigned int num_points)
+    {
+        const auto exponentMask = _mm512_set1_epi32(0xFF);
+        const auto exponentBias = _mm512_set1_epi32(127);
+        const auto fractionMask = _mm512_set1_epi32(0x007FFFFF);
+        const auto oneBits = _mm512_set1_epi32(0x3F800000);
+        const auto one = _mm512_set1_ps(1.0f);
+
+        unsigned int number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto bits = _mm512_castps_si512(_mm512_loadu_ps(input + number));
+
+            const auto biased = _mm512_and_si512(_mm512_srli_epi32(bits, 23), exponentMask);
+            const auto exponent = _mm512_cvtepi32_ps(_mm512_sub_epi32(biased, exponentBias));
+
+            // Mantissa in [1,2)
+            const auto mantissa = _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, fractionMask), oneBits));
+
+            auto poly = _mm512_set1_ps(ToDBKernels::FastLog2Poly[0]);
+            for(size_t i = 1; i < ToDBKernels::NumFastLog2Coeffs; ++i)
+            {
+                poly = _mm512_fmadd_ps(poly, mantissa, _mm512_set1_ps(ToDBKernels::FastLog2Poly[i]));
+            }
+
+            _mm512_storeu_ps(output + number, _mm512_fmadd_ps(poly, _mm512_sub_ps(mantissa, one), exponent));
+        }
+
+        ToDBKernels::Generic::fastLog2(output + number, input + number, num_points - number);
+    }
+}}
+
+const ToDBKernels::KernelTable& ToDBKernels::getAVX512KernelTable()
+{
+    static const KernelTable table =
+    {
+        &AVX512::fastLog2,
+    };
+
+    return table;
+}
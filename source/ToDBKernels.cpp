@@ -0,0 +1,87 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ToDBKernels.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+//
+// Generic implementations
+//
+
+void ToDBKernels::Generic::fastLog2(float* output, const float* input, unsigned int num_points)
+{
+    for(unsigned int number = 0; number < num_points; ++number)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &input[number], sizeof(bits));
+
+        const auto exponent = float(int((bits >> 23) & 0xFF) - 127);
+
+        // Mantissa in [1,2)
+        bits = (bits & 0x007FFFFFU) | 0x3F800000U;
+        float mantissa;
+        std::memcpy(&mantissa, &bits, sizeof(mantissa));
+
+        float poly = FastLog2Poly[0];
+        for(size_t i = 1; i < NumFastLog2Coeffs; ++i)
+        {
+            poly = (poly * mantissa) + FastLog2Poly[i];
+        }
+
+        output[number] = exponent + (poly * (mantissa - 1.0f));
+    }
+}
+
+const ToDBKernels::KernelTable& ToDBKernels::getGenericKernelTable()
+{
+    static const KernelTable table =
+    {
+        &Generic::fastLog2,
+    };
+
+    return table;
+}
+
+//
+// Runtime selection
+//
+
+std::vector<std::pair<std::string, ToDBKernels::KernelTable>> ToDBKernels::getSupportedKernelTables()
+{
+    std::vector<std::pair<std::string, KernelTable>> tables;
+    tables.emplace_back("generic", getGenericKernelTable());
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+
+#ifdef POTHOSVOLK_TODB_SSE41
+    if(__builtin_cpu_supports("sse4.1")) tables.emplace_back("sse4_1", getSSE41KernelTable());
+#endif
+#ifdef POTHOSVOLK_TODB_AVX2
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) tables.emplace_back("avx2", getAVX2KernelTable());
+#endif
+#ifdef POTHOSVOLK_TODB_AVX512
+    if(__builtin_cpu_supports("avx512f")) tables.emplace_back("avx512", getAVX512KernelTable());
+#endif
+#endif
+
+    return tables;
+}
+
+// Only checked once, rather than on every call.
+static const ToDBKernels::KernelTable& getFastestKernelTable()
+{
+    static const ToDBKernels::KernelTable table = ToDBKernels::getSupportedKernelTables().back().second;
+    return table;
+}
+
+//
+// Dispatchers
+//
+
+void ToDBKernels::fastLog2(float* output, const float* input, unsigned int num_points)
+{
+    getFastestKernelTable().fastLog2(output, input, num_points);
+}
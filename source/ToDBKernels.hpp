@@ -0,0 +1,67 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+// The approximate log2 used by /volk/to_db's FAST precision. This isn't
+// a VOLK kernel, but like the fallback kernels, it's built for each
+// instruction set and the fastest one the CPU supports is selected at
+// runtime.
+
+namespace ToDBKernels
+{
+    using FastLog2Fcn = void(*)(float*, const float*, unsigned int);
+
+    // The coefficients of fastLog2's polynomial, highest order first.
+    // This is the degree-4 fit from VOLK's log2 kernels, which use the
+    // more accurate degree-6 fit by default.
+    constexpr float FastLog2Poly[] =
+    {
+        -0.107254423828329604454f,
+        0.688243882994381274313f,
+        -1.75647175389045657003f,
+        2.61761038894603480148f
+    };
+    constexpr size_t NumFastLog2Coeffs = sizeof(FastLog2Poly) / sizeof(FastLog2Poly[0]);
+
+    namespace Generic
+    {
+        // Approximates log2 from the float's exponent and a polynomial
+        // of its mantissa, with a maximum error of about 4e-4. Signs are
+        // ignored, and zero maps to -127 instead of -inf.
+        void fastLog2(float* output, const float* input, unsigned int num_points);
+    }
+
+    // One implementation of each kernel
+    struct KernelTable
+    {
+        FastLog2Fcn fastLog2;
+    };
+
+    const KernelTable& getGenericKernelTable();
+
+    // As in FallbackKernels.hpp, each of these is only built if the
+    // compiler supports its instruction set, and must only be called if
+    // the CPU does too.
+#ifdef POTHOSVOLK_TODB_SSE41
+    const KernelTable& getSSE41KernelTable();
+#endif
+#ifdef POTHOSVOLK_TODB_AVX2
+    const KernelTable& getAVX2KernelTable();
+#endif
+#ifdef POTHOSVOLK_TODB_AVX512
+    const KernelTable& getAVX512KernelTable();
+#endif
+
+    // The generic table, followed by each table this build and the CPU
+    // support, from slowest to fastest
+    std::vector<std::pair<std::string, KernelTable>> getSupportedKernelTables();
+
+    // The fastest supported implementation of each kernel
+    void fastLog2(float* output, const float* input, unsigned int num_points);
+}
@@ -0,0 +1,56 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "ToDBKernels.hpp"
+
+#include <smmintrin.h>
+
+// As in FallbackSIMD.hpp, this file must not instantiate any inline
+// function or template with external linkage, and tails use the generic
+// implementations.
+
+namespace { namespace SSE41
+{
+    constexpr unsigned int Width = 4;
+
+    void fastLog2(float* output, const float* input, unsigned int num_points)
+    {
+        const auto exponentMask = _mm_set1_epi32(0xFF);
+        const auto exponentBias = _mm_set1_epi32(127);
+        const auto fractionMask = _mm_set1_epi32(0x007FFFFF);
+        const auto oneBits = _mm_set1_epi32(0x3F800000);
+        const auto one = _mm_set1_ps(1.0f);
+
+        unsigned int number = 0;
+        for(; (number + Width) <= num_points; number += Width)
+        {
+            const auto bits = _mm_castps_si128(_mm_loadu_ps(input + number));
+
+            const auto biased = _mm_and_si128(_mm_srli_epi32(bits, 23), exponentMask);
+            const auto exponent = _mm_cvtepi32_ps(_mm_sub_epi32(biased, exponentBias));
+
+            // Mantissa in [1,2)
+            const auto mantissa = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, fractionMask), oneBits));
+
+            auto poly = _mm_set1_ps(ToDBKernels::FastLog2Poly[0]);
+            for(size_t i = 1; i < ToDBKernels::NumFastLog2Coeffs; ++i)
+            {
+                poly = _mm_add_ps(_mm_mul_ps(poly, mantissa), _mm_set1_ps(ToDBKernels::FastLog2Poly[i]));
+            }
+
+            _mm_storeu_ps(output + number, _mm_add_ps(_mm_mul_ps(poly, _mm_sub_ps(mantissa, one)), exponent));
+        }
+
+        ToDBKernels::Generic::fastLog2(output + number, input + number, num_points - number);
+    }
+}}
+
+const ToDBKernels::KernelTable& ToDBKernels::getSSE41KernelTable()
+{
+    static const KernelTable table =
+    {
+        &SSE41::fastLog2,
+    };
+
+    return table;
+}
@@ -0,0 +1,157 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+// The eight unpacked bits of each byte value, so each byte is unpacked
+// with a single eight-byte copy.
+using UnpackTable = std::array<std::array<int8_t, 8>, 256>;
+
+static UnpackTable getUnpackTable(bool msbFirst)
+{
+    UnpackTable table;
+    for(size_t value = 0; value < table.size(); ++value)
+    {
+        for(size_t bit = 0; bit < 8; ++bit)
+        {
+            const auto shift = msbFirst ? (7 - bit) : bit;
+            table[value][bit] = int8_t((value >> shift) & 1);
+        }
+    }
+
+    return table;
+}
+
+//
+// Interface
+//
+
+class UnpackBits: public VOLKBlock
+{
+    public:
+        static Pothos::Block* make();
+
+        UnpackBits();
+        virtual ~UnpackBits() = default;
+
+        std::string bitOrder() const
+        {
+            return _msbFirst ? "MSB" : "LSB";
+        }
+
+        void setBitOrder(const std::string& bitOrder);
+
+        void work() override;
+
+        void propagateLabels(const Pothos::InputPort* input) override;
+
+    private:
+        bool _msbFirst;
+};
+
+//
+// Implementation
+//
+
+Pothos::Block* UnpackBits::make()
+{
+    return new UnpackBits();
+}
+
+UnpackBits::UnpackBits():
+    VOLKBlock(),
+    _msbFirst(true)
+{
+    this->setupInput(0, "uint8");
+    this->setupOutput(0, "int8");
+
+    this->registerCall(this, POTHOS_FCN_TUPLE(UnpackBits, bitOrder));
+    this->registerCall(this, POTHOS_FCN_TUPLE(UnpackBits, setBitOrder));
+}
+
+void UnpackBits::setBitOrder(const std::string& bitOrder)
+{
+    if(bitOrder == "MSB")      _msbFirst = true;
+    else if(bitOrder == "LSB") _msbFirst = false;
+    else throw Pothos::InvalidArgumentException("Invalid bit order: " + bitOrder);
+}
+
+void UnpackBits::work()
+{
+    static const auto MSBFirstTable = getUnpackTable(true);
+    static const auto LSBFirstTable = getUnpackTable(false);
+
+    auto input = this->input(0);
+    auto output = this->output(0);
+
+    const auto numBytes = std::min(
+        input->elements(),
+        output->elements() / 8);
+    if(0 == numBytes) return;
+
+    const uint8_t* inputBuffer = input->buffer();
+    int8_t* outputBuffer = output->buffer();
+
+    const auto& table = _msbFirst ? MSBFirstTable : LSBFirstTable;
+    for(size_t byte = 0; byte < numBytes; ++byte)
+    {
+        std::memcpy(
+            outputBuffer + (byte * 8),
+            table[inputBuffer[byte]].data(),
+            8);
+    }
+
+    input->consume(numBytes);
+    output->produce(numBytes * 8);
+}
+
+void UnpackBits::propagateLabels(const Pothos::InputPort* input)
+{
+    auto output = this->output(0);
+    for(const auto& label: input->labels())
+    {
+        output->postLabel(label.toAdjusted(8, 1));
+    }
+}
+
+/***********************************************************************
+ * |PothosDoc Unpack Bits (VOLK)
+ *
+ * <p>
+ * Unpacks each input byte into eight int8 outputs of <b>0</b> or
+ * <b>1</b>, in the given bit order. This is the inverse of
+ * <b>/volk/pack_bits</b>, and matches the output of
+ * <b>/volk/binary_slicer</b>.
+ * </p>
+ *
+ * <p>
+ * Each byte is unpacked with a single eight-byte copy from a lookup
+ * table.
+ * </p>
+ *
+ * |category /Digital/VOLK
+ * |category /VOLK/Digital
+ * |keywords bit byte unpack
+ *
+ * |param bitOrder[Bit Order]
+ * The position of the first output bit in each input byte.
+ * |widget ComboBox(editable=false)
+ * |default "MSB"
+ * |option [MSB First] "MSB"
+ * |option [LSB First] "LSB"
+ * |preview enable
+ *
+ * |factory /volk/unpack_bits()
+ * |setter setBitOrder(bitOrder)
+ **********************************************************************/
+static Pothos::BlockRegistry registerVOLKUnpackBits(
+    "/volk/unpack_bits",
+    &UnpackBits::make);
@@ -5,26 +5,66 @@
 
 #include "SharedBufferAllocator.hpp"
 
+#include <Pothos/Exception.hpp>
 #include <Pothos/Framework.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <functional>
+#include <map>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 //
 // VOLKBlock
 //
 
+// Blocks that stage values between kernel calls, such as kept inputs
+// when decimating or broadcast scalars, do so in tiles of at most this
+// many elements. At 8 KiB for complex float32, a tile and its source stay
+// in the L1 cache between the calls.
+static constexpr size_t TileElems = 1024;
+
 class VOLKBlock: public Pothos::Block
 {
     public:
-        VOLKBlock(){}
+        VOLKBlock():
+#ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+            _volkBufferAllocatorEnabled(true),
+#endif
+            _decimation(1),
+            _decimationOffset(0),
+            _workStartOffset(0)
+        {
+#ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+            this->registerCall(this, POTHOS_FCN_TUPLE(VOLKBlock, volkBufferAllocatorEnabled));
+            this->registerCall(this, POTHOS_FCN_TUPLE(VOLKBlock, setVOLKBufferAllocatorEnabled));
+#endif
+        }
+
         virtual ~VOLKBlock() = default;
 
 #ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+        bool volkBufferAllocatorEnabled() const
+        {
+            return _volkBufferAllocatorEnabled;
+        }
+
+        // When disabled, this block uses the framework's default buffers
+        // instead, as of the next time its topology is committed. This is
+        // only meant for comparing the two in benchmarks.
+        void setVOLKBufferAllocatorEnabled(bool enabled)
+        {
+            _volkBufferAllocatorEnabled = enabled;
+        }
+
         Pothos::BufferManager::Sptr getInputBufferManager(
-            const std::string&,
-            const std::string&) override
+            const std::string& name,
+            const std::string& domain) override
         {
+            if(!_volkBufferAllocatorEnabled) return Pothos::Block::getInputBufferManager(name, domain);
+
             auto bufferManager = Pothos::BufferManager::make("generic");
             bufferManager->setAllocateFunction(&volkSharedBufferAllocator);
 
@@ -32,9 +72,11 @@ class VOLKBlock: public Pothos::Block
         }
 
         Pothos::BufferManager::Sptr getOutputBufferManager(
-            const std::string&,
-            const std::string&) override
+            const std::string& name,
+            const std::string& domain) override
         {
+            if(!_volkBufferAllocatorEnabled) return Pothos::Block::getOutputBufferManager(name, domain);
+
             auto bufferManager = Pothos::BufferManager::make("generic");
             bufferManager->setAllocateFunction(&volkSharedBufferAllocator);
 
@@ -43,6 +85,281 @@ class VOLKBlock: public Pothos::Block
 #endif
 
         virtual void work() override = 0;
+
+        // Setter labels are consumed by this block, so only forward the rest.
+        void propagateLabels(const Pothos::InputPort* input) override
+        {
+            for(const auto& label: input->labels())
+            {
+                if(this->_isSetterLabel(label)) continue;
+
+                const auto outputLabel = (_decimation > 1) ? this->_decimatedLabel(label, _workStartOffset) : label;
+                for(auto* output: this->outputs()) output->postLabel(outputLabel);
+            }
+        }
+
+        size_t decimation() const
+        {
+            return _decimation;
+        }
+
+        // If greater than one, only every decimation-th input is processed
+        // and output, starting with the next input.
+        virtual void setDecimation(size_t decimation)
+        {
+            if(0 == decimation) throw Pothos::InvalidArgumentException("Decimation must be non-zero.");
+
+            _decimation = decimation;
+            _decimationOffset = 0;
+        }
+
+    protected:
+        // Only blocks whose work functions support decimation register these.
+        void _registerDecimationCalls()
+        {
+            this->registerCall(this, POTHOS_FCN_TUPLE(VOLKBlock, decimation));
+            this->registerCall(this, POTHOS_FCN_TUPLE(VOLKBlock, setDecimation));
+        }
+
+        using SetterLabelFcn = std::function<void(const Pothos::Object&)>;
+
+        // Allows a parameter to also be set by an input label with the
+        // given ID, which is applied at the label's exact sample. This
+        // avoids the latency of going through the block's actor.
+        void _registerSetterLabel(
+            const std::string& labelID,
+            const SetterLabelFcn& setter)
+        {
+            _setterLabels[labelID] = setter;
+        }
+
+        bool _isSetterLabel(const Pothos::Label& label) const
+        {
+            return (_setterLabels.count(label.id) > 0);
+        }
+
+        // Applies any setter labels with an index in [begin,end).
+        void _applySetterLabels(
+            const Pothos::InputPort* input,
+            size_t begin,
+            size_t end)
+        {
+            if(_setterLabels.empty()) return;
+
+            for(const auto& label: input->labels())
+            {
+                if((label.index < begin) || (label.index >= end)) continue;
+
+                auto iter = _setterLabels.find(label.id);
+                if(iter != _setterLabels.end()) iter->second(label.data);
+            }
+        }
+
+        // Applies any setter labels at the given offset, then returns how
+        // many of the remaining elements come before the next one. Kernel
+        // calls are split on these spans so each label lands exactly.
+        size_t _setterLabelSpan(
+            const Pothos::InputPort* input,
+            size_t offset,
+            size_t elems)
+        {
+            if(_setterLabels.empty()) return (elems - offset);
+
+            this->_applySetterLabels(input, offset, offset+1);
+
+            size_t next = elems;
+            for(const auto& label: input->labels())
+            {
+                if((label.index > offset) && (label.index < next) && this->_isSetterLabel(label))
+                {
+                    next = size_t(label.index);
+                }
+            }
+
+            return (next - offset);
+        }
+
+        // Pops the next message from the input. Packets are returned
+        // through the given reference, and anything else is forwarded
+        // to the output as-is.
+        bool _popPacket(
+            Pothos::InputPort* input,
+            Pothos::OutputPort* output,
+            Pothos::Packet& packet)
+        {
+            auto msg = input->popMessage();
+            if(msg.type() != typeid(Pothos::Packet))
+            {
+                output->postMessage(std::move(msg));
+                return false;
+            }
+
+            // Copy the packet out and release the message, so the payload
+            // is only referenced by this copy if no one else holds it.
+            packet = msg.extract<Pothos::Packet>();
+            msg = Pothos::Object();
+
+            return true;
+        }
+
+        // Converts the packet's payload to the input type if needed, and
+        // returns the buffer the kernel should write to. If the types match
+        // and the payload isn't referenced elsewhere, the kernel runs in
+        // place.
+        template <typename InType, typename OutType>
+        static Pothos::BufferChunk _packetOutputPayload(Pothos::Packet& packet)
+        {
+            static const Pothos::DType inDType(typeid(InType));
+            static const Pothos::DType outDType(typeid(OutType));
+
+            if(!(packet.payload.dtype == inDType)) packet.payload = packet.payload.convert(inDType);
+
+            if(std::is_same<InType, OutType>::value && packet.payload.unique()) return packet.payload;
+            else return Pothos::BufferChunk(outDType, packet.payload.elements());
+        }
+
+        // For two-input blocks broadcasting input 1, each of whose values
+        // covers broadcastSize outputs. The first value consumed started
+        // startPhase outputs before the start of this call's outputs.
+        void _propagateBroadcastLabels(
+            const Pothos::InputPort* input,
+            size_t broadcastSize,
+            size_t startPhase)
+        {
+            auto output = this->output(0);
+            for(const auto& label: input->labels())
+            {
+                if(this->_isSetterLabel(label)) continue;
+
+                auto adjusted = label.toAdjusted(broadcastSize, 1);
+                adjusted.index = (adjusted.index > startPhase) ? (adjusted.index - startPhase) : 0;
+                output->postLabel(adjusted);
+            }
+        }
+
+#ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+        bool _volkBufferAllocatorEnabled;
+#endif
+
+        //
+        // Decimation
+        //
+
+        size_t _decimation;
+
+        // The index of the next kept input, relative to the start of the
+        // current call's inputs. This carries the phase across calls.
+        size_t _decimationOffset;
+        size_t _workStartOffset;
+
+        // The number of inputs to consume, out of those available, so
+        // every kept one fits in the available outputs
+        size_t _decimatedInputs(size_t inElems, size_t outElems) const
+        {
+            return std::min(inElems, _decimationOffset + (outElems * _decimation));
+        }
+
+        // The number of kept inputs among the first elems inputs
+        size_t _decimatedOutputs(size_t elems) const
+        {
+            if(elems <= _decimationOffset) return 0;
+            return ((elems - _decimationOffset - 1) / _decimation) + 1;
+        }
+
+        // The input index of the given output
+        size_t _keptIndex(size_t output) const
+        {
+            return _decimationOffset + (output * _decimation);
+        }
+
+        // Updates the phase after consuming elems inputs.
+        void _advanceDecimation(size_t elems, size_t numOutputs)
+        {
+            _workStartOffset = _decimationOffset;
+            _decimationOffset = this->_keptIndex(numOutputs) - elems;
+        }
+
+        // Moves a label to the first output kept at or after it, given the
+        // input index of the first kept input.
+        Pothos::Label _decimatedLabel(
+            const Pothos::Label& label,
+            size_t firstKept) const
+        {
+            const auto index = size_t(label.index);
+
+            auto adjusted = label.toAdjusted(1, _decimation);
+            adjusted.index = (index > firstKept) ? (((index - firstKept) + _decimation - 1) / _decimation) : 0;
+
+            return adjusted;
+        }
+
+        template <typename T>
+        void _gatherDecimated(
+            T* tile,
+            const T* input,
+            size_t first,
+            size_t count) const
+        {
+            const T* kept = input + first;
+            for(size_t i = 0; i < count; ++i) tile[i] = kept[i * _decimation];
+        }
+
+        // Runs kernel(output, tile, tileElems) on each tile of kept inputs,
+        // starting with the input at index first.
+        template <typename InType, typename OutType, typename KernelFcn>
+        void _runDecimated(
+            OutType* output,
+            const InType* input,
+            size_t first,
+            size_t numOutputs,
+            std::vector<InType>& tile,
+            const KernelFcn& kernel) const
+        {
+            tile.resize(TileElems);
+
+            for(size_t outOffset = 0; outOffset < numOutputs; outOffset += TileElems)
+            {
+                const auto tileElems = std::min(TileElems, numOutputs - outOffset);
+
+                this->_gatherDecimated(tile.data(), input, first + (outOffset * _decimation), tileElems);
+                kernel(output + outOffset, tile.data(), tileElems);
+            }
+        }
+
+        // Packets are decimated from their first element, independent of
+        // the stream's phase.
+        template <typename InType, typename OutType, typename KernelFcn>
+        void _decimatePacket(
+            Pothos::Packet& packet,
+            std::vector<InType>& tile,
+            const KernelFcn& kernel) const
+        {
+            static const Pothos::DType inDType(typeid(InType));
+            static const Pothos::DType outDType(typeid(OutType));
+
+            if(!(packet.payload.dtype == inDType)) packet.payload = packet.payload.convert(inDType);
+
+            const auto numOutputs = (packet.payload.elements() + _decimation - 1) / _decimation;
+            Pothos::BufferChunk outputPayload(outDType, numOutputs);
+
+            this->_runDecimated(
+                outputPayload.template as<OutType*>(),
+                packet.payload.template as<const InType*>(),
+                0,
+                numOutputs,
+                tile,
+                kernel);
+
+            packet.payload = std::move(outputPayload);
+            for(auto& label: packet.labels)
+            {
+                label = this->_decimatedLabel(label, 0);
+                label.index = std::min<size_t>(label.index, (numOutputs > 0) ? (numOutputs - 1) : 0);
+            }
+        }
+
+    private:
+        std::map<std::string, SetterLabelFcn> _setterLabels;
 };
 
 //
@@ -73,18 +390,67 @@ class OneToOneBlock: public VOLKBlock
 
             this->setupInput(0, inDType);
             this->setupOutput(0, outDType);
+
+            this->_registerDecimationCalls();
         }
 
         virtual ~OneToOneBlock() = default;
 
         void work() override
         {
-            const auto elems = this->workInfo().minElements;
-            if(0 == elems) return;
-
             auto input = this->input(0);
             auto output = this->output(0);
 
+            const auto kernel = [this](OutType* out, const InType* in, size_t elems)
+            {
+                _fcn(out, in, static_cast<unsigned int>(elems));
+            };
+
+            // Packets are processed directly, without going through the
+            // stream buffers.
+            Pothos::Packet packet;
+            if(input->hasMessage() && this->_popPacket(input, output, packet))
+            {
+                if(this->_decimation > 1)
+                {
+                    this->template _decimatePacket<InType, OutType>(packet, _decimationTile, kernel);
+                }
+                else
+                {
+                    auto outputPayload = VOLKBlock::_packetOutputPayload<InType, OutType>(packet);
+
+                    _fcn(outputPayload.template as<OutType*>(),
+                         packet.payload.template as<const InType*>(),
+                         static_cast<unsigned int>(packet.payload.elements()));
+
+                    packet.payload = std::move(outputPayload);
+                }
+                output->postMessage(std::move(packet));
+            }
+
+            if(this->_decimation > 1)
+            {
+                const auto elems = this->_decimatedInputs(input->elements(), output->elements());
+                if(0 == elems) return;
+
+                const auto numOutputs = this->_decimatedOutputs(elems);
+                this->_runDecimated(
+                    output->buffer().template as<OutType*>(),
+                    input->buffer().template as<const InType*>(),
+                    this->_keptIndex(0),
+                    numOutputs,
+                    _decimationTile,
+                    kernel);
+
+                input->consume(elems);
+                if(numOutputs > 0) output->produce(numOutputs);
+                this->_advanceDecimation(elems, numOutputs);
+                return;
+            }
+
+            const auto elems = this->workInfo().minElements;
+            if(0 == elems) return;
+
             _fcn(output->buffer().template as<OutType*>(),
                  input->buffer().template as<const InType*>(),
                  static_cast<unsigned int>(elems));
@@ -95,6 +461,7 @@ class OneToOneBlock: public VOLKBlock
 
     protected:
         Fcn _fcn;
+        std::vector<InType> _decimationTile;
 };
 
 //
@@ -137,6 +504,15 @@ class OneToOneScalarParamBlock: public VOLKBlock
 
             this->registerCall(this, getterName, &Class::scalar);
             this->registerCall(this, setterName, &Class::setScalar);
+
+            this->_registerSetterLabel(
+                setterName,
+                [this](const Pothos::Object& value)
+                {
+                    this->setScalar(value.convert<ScalarType>());
+                });
+
+            this->_registerDecimationCalls();
         }
 
         virtual ~OneToOneScalarParamBlock() = default;
@@ -153,16 +529,60 @@ class OneToOneScalarParamBlock: public VOLKBlock
 
         void work() override
         {
+            auto input = this->input(0);
+            auto output = this->output(0);
+
+            const auto kernel = [this](OutType* out, const InType* in, size_t elems)
+            {
+                this->_runKernel(out, in, elems);
+            };
+
+            // Packets are processed directly, without going through the
+            // stream buffers.
+            Pothos::Packet packet;
+            if(input->hasMessage() && this->_popPacket(input, output, packet))
+            {
+                if(this->_decimation > 1)
+                {
+                    this->template _decimatePacket<InType, OutType>(packet, _decimationTile, kernel);
+                }
+                else
+                {
+                    auto outputPayload = VOLKBlock::_packetOutputPayload<InType, OutType>(packet);
+
+                    this->_runKernel(
+                        outputPayload.template as<OutType*>(),
+                        packet.payload.template as<const InType*>(),
+                        packet.payload.elements());
+
+                    packet.payload = std::move(outputPayload);
+                }
+                output->postMessage(std::move(packet));
+            }
+
+            if(this->_decimation > 1)
+            {
+                this->_decimatedWork(kernel);
+                return;
+            }
+
             const auto elems = this->workInfo().minElements;
             if(0 == elems) return;
 
-            auto input = this->input(0);
-            auto output = this->output(0);
+            OutType* outputBuffer = output->buffer();
+            const InType* inputBuffer = input->buffer();
 
-            _fcn(output->buffer().template as<OutType*>(),
-                 input->buffer().template as<const InType*>(),
-                 _scalar,
-                 static_cast<unsigned int>(elems));
+            for(size_t offset = 0; offset < elems;)
+            {
+                const auto spanElems = this->_setterLabelSpan(input, offset, elems);
+
+                this->_runKernel(
+                    outputBuffer + offset,
+                    inputBuffer + offset,
+                    spanElems);
+
+                offset += spanElems;
+            }
 
             input->consume(elems);
             output->produce(elems);
@@ -171,6 +591,54 @@ class OneToOneScalarParamBlock: public VOLKBlock
     protected:
         Fcn _fcn;
         ScalarType _scalar;
+        std::vector<InType> _decimationTile;
+
+        // Subclasses can override this to add steps around the kernel.
+        virtual void _runKernel(
+            OutType* output,
+            const InType* input,
+            size_t elems)
+        {
+            _fcn(output, input, _scalar, static_cast<unsigned int>(elems));
+        }
+
+    private:
+        // Kernel calls are still split on setter labels, so each one
+        // applies from the first kept input at or after it.
+        template <typename KernelFcn>
+        void _decimatedWork(const KernelFcn& kernel)
+        {
+            auto input = this->input(0);
+            auto output = this->output(0);
+
+            const auto elems = this->_decimatedInputs(input->elements(), output->elements());
+            if(0 == elems) return;
+
+            OutType* outputBuffer = output->buffer();
+            const InType* inputBuffer = input->buffer();
+
+            size_t numOutputs = 0;
+            for(size_t offset = 0; offset < elems;)
+            {
+                const auto spanElems = this->_setterLabelSpan(input, offset, elems);
+                const auto spanOutputs = this->_decimatedOutputs(offset + spanElems) - numOutputs;
+
+                this->_runDecimated(
+                    outputBuffer + numOutputs,
+                    inputBuffer,
+                    this->_keptIndex(numOutputs),
+                    spanOutputs,
+                    _decimationTile,
+                    kernel);
+
+                numOutputs += spanOutputs;
+                offset += spanElems;
+            }
+
+            input->consume(elems);
+            if(numOutputs > 0) output->produce(numOutputs);
+            this->_advanceDecimation(elems, numOutputs);
+        }
 };
 
 //
@@ -339,12 +807,18 @@ class OneToTwoScalarParamBlock: public VOLKBlock
 template <typename InType0, typename InType1, typename OutType>
 using TwoToOneFcn = void(*)(OutType*, const InType0*, const InType1*, unsigned int);
 
+// When broadcasting, each input 1 value is applied to a span of input 0
+// with one of these, if given.
+template <typename InType0, typename InType1, typename OutType>
+using BroadcastFcn = OneToOneScalarParamFcn<InType0, OutType, InType1>;
+
 template <typename InType0, typename InType1, typename OutType, typename InputPortType>
 class TwoToOneBlock: public VOLKBlock
 {
     public:
         using Class = TwoToOneBlock<InType0, InType1, OutType, InputPortType>;
         using Fcn = TwoToOneFcn<InType0, InType1, OutType>;
+        using ScalarFcn = BroadcastFcn<InType0, InType1, OutType>;
 
         static Pothos::Block* make(
             Fcn fcn,
@@ -354,14 +828,28 @@ class TwoToOneBlock: public VOLKBlock
             return new Class(fcn, inputPort0Name, inputPort1Name);
         }
 
+        static Pothos::Block* makeWithBroadcastFcn(
+            Fcn fcn,
+            ScalarFcn broadcastFcn,
+            const InputPortType& inputPort0Name,
+            const InputPortType& inputPort1Name)
+        {
+            return new Class(fcn, inputPort0Name, inputPort1Name, broadcastFcn);
+        }
+
         TwoToOneBlock(
             Fcn fcn,
             const InputPortType& inputPort0Name,
-            const InputPortType& inputPort1Name
+            const InputPortType& inputPort1Name,
+            ScalarFcn broadcastFcn = nullptr
         ):
             _fcn(fcn),
+            _broadcastFcn(broadcastFcn),
             _inputPort0Name(inputPort0Name),
-            _inputPort1Name(inputPort1Name)
+            _inputPort1Name(inputPort1Name),
+            _broadcastSize(0),
+            _broadcastPhase(0),
+            _workStartPhase(0)
         {
             assert(_fcn);
 
@@ -372,12 +860,58 @@ class TwoToOneBlock: public VOLKBlock
             this->setupInput(_inputPort0Name, inDType0);
             this->setupInput(_inputPort1Name, inDType1);
             this->setupOutput(0, outDType);
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, broadcastSize));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setBroadcastSize));
+            this->_registerDecimationCalls();
         }
 
         virtual ~TwoToOneBlock() = default;
 
+        size_t broadcastSize() const
+        {
+            return _broadcastSize;
+        }
+
+        // If non-zero, each input 1 value is applied to this many input 0
+        // values.
+        void setBroadcastSize(size_t broadcastSize)
+        {
+            if((broadcastSize > 0) && (this->_decimation > 1))
+            {
+                throw Pothos::InvalidArgumentException("Broadcasting cannot be combined with decimation.");
+            }
+
+            _broadcastSize = broadcastSize;
+            _broadcastPhase = 0;
+
+            if(!_broadcastFcn) _broadcastBuffer.resize(std::min(_broadcastSize, TileElems));
+        }
+
+        void setDecimation(size_t decimation) override
+        {
+            if((decimation > 1) && (_broadcastSize > 0))
+            {
+                throw Pothos::InvalidArgumentException("Decimation cannot be combined with broadcasting.");
+            }
+
+            VOLKBlock::setDecimation(decimation);
+        }
+
         void work() override
         {
+            if(_broadcastSize > 0)
+            {
+                this->_broadcastWork();
+                return;
+            }
+
+            if(this->_decimation > 1)
+            {
+                this->_decimatedWork();
+                return;
+            }
+
             const auto elems = this->workInfo().minAllElements;
             if(0 == elems) return;
 
@@ -395,10 +929,122 @@ class TwoToOneBlock: public VOLKBlock
             output->produce(elems);
         }
 
+        void propagateLabels(const Pothos::InputPort* input) override
+        {
+            if((_broadcastSize > 0) && (input == this->input(_inputPort1Name)))
+            {
+                this->_propagateBroadcastLabels(input, _broadcastSize, _workStartPhase);
+            }
+            else VOLKBlock::propagateLabels(input);
+        }
+
     protected:
         Fcn _fcn;
+        ScalarFcn _broadcastFcn;
         InputPortType _inputPort0Name;
         InputPortType _inputPort1Name;
+
+        size_t _broadcastSize;
+        size_t _broadcastPhase;
+        size_t _workStartPhase;
+        std::vector<InType1> _broadcastBuffer;
+
+        std::vector<InType0> _decimationTile0;
+        std::vector<InType1> _decimationTile1;
+
+        void _decimatedWork()
+        {
+            auto input0 = this->input(_inputPort0Name);
+            auto input1 = this->input(_inputPort1Name);
+            auto output = this->output(0);
+
+            const auto elems = this->_decimatedInputs(
+                std::min(input0->elements(), input1->elements()),
+                output->elements());
+            if(0 == elems) return;
+
+            OutType* outputBuffer = output->buffer();
+            const InType0* inputBuffer0 = input0->buffer();
+            const InType1* inputBuffer1 = input1->buffer();
+
+            _decimationTile0.resize(TileElems);
+            _decimationTile1.resize(TileElems);
+
+            const auto numOutputs = this->_decimatedOutputs(elems);
+            for(size_t outOffset = 0; outOffset < numOutputs; outOffset += TileElems)
+            {
+                const auto tileElems = std::min(TileElems, numOutputs - outOffset);
+                const auto first = this->_keptIndex(outOffset);
+
+                this->_gatherDecimated(_decimationTile0.data(), inputBuffer0, first, tileElems);
+                this->_gatherDecimated(_decimationTile1.data(), inputBuffer1, first, tileElems);
+
+                _fcn(outputBuffer + outOffset,
+                     _decimationTile0.data(),
+                     _decimationTile1.data(),
+                     static_cast<unsigned int>(tileElems));
+            }
+
+            input0->consume(elems);
+            input1->consume(elems);
+            if(numOutputs > 0) output->produce(numOutputs);
+            this->_advanceDecimation(elems, numOutputs);
+        }
+
+        void _broadcastWork()
+        {
+            auto input0 = this->input(_inputPort0Name);
+            auto input1 = this->input(_inputPort1Name);
+            auto output = this->output(0);
+
+            const auto elems = std::min(input0->elements(), output->elements());
+            const auto numValues = input1->elements();
+            if((0 == elems) || (0 == numValues)) return;
+
+            OutType* outputBuffer = output->buffer();
+            const InType0* inputBuffer0 = input0->buffer();
+            const InType1* inputBuffer1 = input1->buffer();
+
+            _workStartPhase = _broadcastPhase;
+
+            size_t offset = 0;
+            size_t valueIndex = 0;
+            while((offset < elems) && (valueIndex < numValues))
+            {
+                auto spanElems = std::min(elems - offset, _broadcastSize - _broadcastPhase);
+
+                if(_broadcastFcn)
+                {
+                    _broadcastFcn(
+                        outputBuffer + offset,
+                        inputBuffer0 + offset,
+                        inputBuffer1[valueIndex],
+                        static_cast<unsigned int>(spanElems));
+                }
+                else
+                {
+                    spanElems = std::min(spanElems, _broadcastBuffer.size());
+                    std::fill_n(_broadcastBuffer.data(), spanElems, inputBuffer1[valueIndex]);
+
+                    _fcn(outputBuffer + offset,
+                         inputBuffer0 + offset,
+                         _broadcastBuffer.data(),
+                         static_cast<unsigned int>(spanElems));
+                }
+
+                offset += spanElems;
+                _broadcastPhase += spanElems;
+                if(_broadcastPhase == _broadcastSize)
+                {
+                    _broadcastPhase = 0;
+                    ++valueIndex;
+                }
+            }
+
+            input0->consume(offset);
+            input1->consume(valueIndex);
+            output->produce(offset);
+        }
 };
 
 //
@@ -435,7 +1081,10 @@ class TwoToOneScalarParamBlock: public VOLKBlock
             _fcn(fcn),
             _scalar(ScalarType(0)),
             _inputPort0Name(inputPort0Name),
-            _inputPort1Name(inputPort1Name)
+            _inputPort1Name(inputPort1Name),
+            _broadcastSize(0),
+            _broadcastPhase(0),
+            _workStartPhase(0)
         {
             assert(_fcn);
 
@@ -449,6 +1098,16 @@ class TwoToOneScalarParamBlock: public VOLKBlock
 
             this->registerCall(this, getterName, &Class::scalar);
             this->registerCall(this, setterName, &Class::setScalar);
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, broadcastSize));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setBroadcastSize));
+
+            this->_registerSetterLabel(
+                setterName,
+                [this](const Pothos::Object& value)
+                {
+                    this->setScalar(value.convert<ScalarType>());
+                });
         }
 
         virtual ~TwoToOneScalarParamBlock() = default;
@@ -463,6 +1122,180 @@ class TwoToOneScalarParamBlock: public VOLKBlock
             _scalar = scalar;
         }
 
+        size_t broadcastSize() const
+        {
+            return _broadcastSize;
+        }
+
+        // If non-zero, each input 1 value is applied to this many input 0
+        // values.
+        void setBroadcastSize(size_t broadcastSize)
+        {
+            _broadcastSize = broadcastSize;
+            _broadcastPhase = 0;
+            _broadcastBuffer.resize(std::min(_broadcastSize, TileElems));
+        }
+
+        void work() override
+        {
+            if(_broadcastSize > 0)
+            {
+                this->_broadcastWork();
+                return;
+            }
+
+            const auto elems = this->workInfo().minAllElements;
+            if(0 == elems) return;
+
+            auto input0 = this->input(_inputPort0Name);
+            auto input1 = this->input(_inputPort1Name);
+            auto output = this->output(0);
+
+            OutType* outputBuffer = output->buffer();
+            const InType0* inputBuffer0 = input0->buffer();
+            const InType1* inputBuffer1 = input1->buffer();
+
+            for(size_t offset = 0; offset < elems;)
+            {
+                const auto spanElems = std::min(
+                    this->_setterLabelSpan(input0, offset, elems),
+                    this->_setterLabelSpan(input1, offset, elems));
+
+                _fcn(outputBuffer + offset,
+                     inputBuffer0 + offset,
+                     inputBuffer1 + offset,
+                     _scalar,
+                     static_cast<unsigned int>(spanElems));
+
+                offset += spanElems;
+            }
+
+            input0->consume(elems);
+            input1->consume(elems);
+            output->produce(elems);
+        }
+
+        void propagateLabels(const Pothos::InputPort* input) override
+        {
+            if((_broadcastSize > 0) && (input == this->input(_inputPort1Name)))
+            {
+                this->_propagateBroadcastLabels(input, _broadcastSize, _workStartPhase);
+            }
+            else VOLKBlock::propagateLabels(input);
+        }
+
+    protected:
+        Fcn _fcn;
+        ScalarType _scalar;
+        InputPortType _inputPort0Name;
+        InputPortType _inputPort1Name;
+
+        size_t _broadcastSize;
+        size_t _broadcastPhase;
+        size_t _workStartPhase;
+        std::vector<InType1> _broadcastBuffer;
+
+        // None of the bound kernels have a scalar variant, so broadcast
+        // values are always expanded. Setter labels are only taken from
+        // input 0, whose indices match the output.
+        void _broadcastWork()
+        {
+            auto input0 = this->input(_inputPort0Name);
+            auto input1 = this->input(_inputPort1Name);
+            auto output = this->output(0);
+
+            const auto elems = std::min(input0->elements(), output->elements());
+            const auto numValues = input1->elements();
+            if((0 == elems) || (0 == numValues)) return;
+
+            OutType* outputBuffer = output->buffer();
+            const InType0* inputBuffer0 = input0->buffer();
+            const InType1* inputBuffer1 = input1->buffer();
+
+            _workStartPhase = _broadcastPhase;
+
+            size_t offset = 0;
+            size_t valueIndex = 0;
+            while((offset < elems) && (valueIndex < numValues))
+            {
+                const auto spanElems = std::min({
+                    elems - offset,
+                    _broadcastSize - _broadcastPhase,
+                    _broadcastBuffer.size(),
+                    this->_setterLabelSpan(input0, offset, elems)});
+
+                std::fill_n(_broadcastBuffer.data(), spanElems, inputBuffer1[valueIndex]);
+
+                _fcn(outputBuffer + offset,
+                     inputBuffer0 + offset,
+                     _broadcastBuffer.data(),
+                     _scalar,
+                     static_cast<unsigned int>(spanElems));
+
+                offset += spanElems;
+                _broadcastPhase += spanElems;
+                if(_broadcastPhase == _broadcastSize)
+                {
+                    _broadcastPhase = 0;
+                    ++valueIndex;
+                }
+            }
+
+            input0->consume(offset);
+            input1->consume(valueIndex);
+            output->produce(offset);
+        }
+};
+
+//
+// ThreeToOneBlock
+//
+
+template <typename InType0, typename InType1, typename InType2, typename OutType>
+using ThreeToOneFcn = void(*)(OutType*, const InType0*, const InType1*, const InType2*, unsigned int);
+
+template <typename InType0, typename InType1, typename InType2, typename OutType, typename InputPortType>
+class ThreeToOneBlock: public VOLKBlock
+{
+    public:
+        using Class = ThreeToOneBlock<InType0, InType1, InType2, OutType, InputPortType>;
+        using Fcn = ThreeToOneFcn<InType0, InType1, InType2, OutType>;
+
+        static Pothos::Block* make(
+            Fcn fcn,
+            const InputPortType& inputPort0Name,
+            const InputPortType& inputPort1Name,
+            const InputPortType& inputPort2Name)
+        {
+            return new Class(fcn, inputPort0Name, inputPort1Name, inputPort2Name);
+        }
+
+        ThreeToOneBlock(
+            Fcn fcn,
+            const InputPortType& inputPort0Name,
+            const InputPortType& inputPort1Name,
+            const InputPortType& inputPort2Name
+        ):
+            _fcn(fcn),
+            _inputPort0Name(inputPort0Name),
+            _inputPort1Name(inputPort1Name),
+            _inputPort2Name(inputPort2Name)
+        {
+            assert(_fcn);
+
+            static const Pothos::DType inDType0(typeid(InType0));
+            static const Pothos::DType inDType1(typeid(InType1));
+            static const Pothos::DType inDType2(typeid(InType2));
+            static const Pothos::DType outDType(typeid(OutType));
+
+            this->setupInput(_inputPort0Name, inDType0);
+            this->setupInput(_inputPort1Name, inDType1);
+            this->setupInput(_inputPort2Name, inDType2);
+            this->setupOutput(0, outDType);
+        }
+
+        virtual ~ThreeToOneBlock() = default;
+
         void work() override
         {
             const auto elems = this->workInfo().minAllElements;
@@ -470,22 +1303,106 @@ class TwoToOneScalarParamBlock: public VOLKBlock
 
             auto input0 = this->input(_inputPort0Name);
             auto input1 = this->input(_inputPort1Name);
+            auto input2 = this->input(_inputPort2Name);
             auto output = this->output(0);
 
             _fcn(output->buffer().template as<OutType*>(),
                  input0->buffer().template as<const InType0*>(),
                  input1->buffer().template as<const InType1*>(),
-                 _scalar,
+                 input2->buffer().template as<const InType2*>(),
                  static_cast<unsigned int>(elems));
 
             input0->consume(elems);
             input1->consume(elems);
+            input2->consume(elems);
             output->produce(elems);
         }
 
     protected:
         Fcn _fcn;
-        ScalarType _scalar;
         InputPortType _inputPort0Name;
         InputPortType _inputPort1Name;
+        InputPortType _inputPort2Name;
+};
+
+//
+// NToOneBlock
+//
+
+// Each input is folded into the output in tiles of this size so the
+// output tile stays in the cache between kernel calls.
+static constexpr size_t NToOneTileBytes = 16384;
+
+template <typename T>
+class NToOneBlock: public VOLKBlock
+{
+    public:
+        using Class = NToOneBlock<T>;
+        using Fcn = TwoToOneFcn<T, T, T>;
+
+        static Pothos::Block* make(
+            Fcn fcn,
+            size_t numInputs)
+        {
+            return new Class(fcn, numInputs);
+        }
+
+        NToOneBlock(
+            Fcn fcn,
+            size_t numInputs
+        ):
+            _fcn(fcn),
+            _tileElems(std::max<size_t>(1, NToOneTileBytes / sizeof(T)))
+        {
+            assert(_fcn);
+
+            if(numInputs < 2)
+            {
+                throw Pothos::InvalidArgumentException("numInputs must be at least 2.");
+            }
+
+            static const Pothos::DType dtype(typeid(T));
+
+            for(size_t input = 0; input < numInputs; ++input) this->setupInput(input, dtype);
+            this->setupOutput(0, dtype);
+        }
+
+        virtual ~NToOneBlock() = default;
+
+        void work() override
+        {
+            const auto elems = this->workInfo().minAllElements;
+            if(0 == elems) return;
+
+            const auto& inputs = this->inputs();
+            auto output = this->output(0);
+
+            T* outputBuffer = output->buffer();
+
+            for(size_t offset = 0; offset < elems; offset += _tileElems)
+            {
+                const auto tileElems = static_cast<unsigned int>(std::min(_tileElems, elems - offset));
+                T* outputTile = outputBuffer + offset;
+
+                _fcn(outputTile,
+                     inputs[0]->buffer().template as<const T*>() + offset,
+                     inputs[1]->buffer().template as<const T*>() + offset,
+                     tileElems);
+
+                for(size_t input = 2; input < inputs.size(); ++input)
+                {
+                    _fcn(outputTile,
+                         outputTile,
+                         inputs[input]->buffer().template as<const T*>() + offset,
+                         tileElems);
+                }
+            }
+
+            for(auto* input: inputs) input->consume(elems);
+            output->produce(elems);
+        }
+
+    protected:
+        Fcn _fcn;
+        size_t _tileElems;
 };
@@ -0,0 +1,296 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "Utility.hpp"
+#include "VOLKBlock.hpp"
+
+#include <Pothos/Exception.hpp>
+
+#include <volk/volk.h>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+//
+// Window generation
+//
+
+// Zeroth-order modified Bessel function of the first kind, used by the
+// Kaiser window.
+static double besselI0(double x)
+{
+    double sum = 1.0;
+    double term = 1.0;
+    const double halfX = x / 2.0;
+
+    for(size_t k = 1; k < 50; ++k)
+    {
+        term *= (halfX / double(k)) * (halfX / double(k));
+        sum += term;
+        if(term < (sum * 1e-12)) break;
+    }
+
+    return sum;
+}
+
+static std::vector<float> generateWindow(
+    const std::string& windowType,
+    size_t windowSize,
+    double kaiserBeta)
+{
+    std::vector<float> window(windowSize, 1.0f);
+    if(windowSize < 2) return window;
+
+    const double M = double(windowSize - 1);
+
+    for(size_t n = 0; n < windowSize; ++n)
+    {
+        const double phase = (2.0 * M_PI * double(n)) / M;
+
+        if(windowType == "HANN")
+        {
+            window[n] = float(0.5 - (0.5 * std::cos(phase)));
+        }
+        else if(windowType == "BLACKMAN")
+        {
+            window[n] = float(0.42 - (0.5 * std::cos(phase)) + (0.08 * std::cos(2.0 * phase)));
+        }
+        else if(windowType == "KAISER")
+        {
+            const double ratio = ((2.0 * double(n)) / M) - 1.0;
+            window[n] = float(besselI0(kaiserBeta * std::sqrt(1.0 - (ratio * ratio))) / besselI0(kaiserBeta));
+        }
+        else if(windowType != "RECTANGULAR")
+        {
+            throw Pothos::InvalidArgumentException("Invalid window type: " + windowType);
+        }
+    }
+
+    return window;
+}
+
+//
+// Block
+//
+
+template <typename T>
+class Window: public VOLKBlock
+{
+    public:
+        using Class = Window<T>;
+        using Fcn = TwoToOneFcn<T,float,T>;
+
+        static Pothos::Block* make(Fcn fcn)
+        {
+            return new Class(fcn);
+        }
+
+        Window(Fcn fcn):
+            VOLKBlock(),
+            _fcn(fcn),
+            _windowType("HANN"),
+            _windowSize(1024),
+            _kaiserBeta(6.0),
+            _phase(0)
+        {
+            static const Pothos::DType dtype(typeid(T));
+
+            this->setupInput(0, dtype);
+            this->setupOutput(0, dtype);
+
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, windowType));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setWindowType));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, windowSize));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setWindowSize));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, kaiserBeta));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setKaiserBeta));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, coefficients));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, setCoefficients));
+            this->registerCall(this, POTHOS_FCN_TUPLE(Class, reset));
+
+            this->_regenerate();
+        }
+
+        virtual ~Window() = default;
+
+        std::string windowType() const
+        {
+            return _windowType;
+        }
+
+        void setWindowType(const std::string& windowType)
+        {
+            if(windowType == "CUSTOM") throw Pothos::InvalidArgumentException("Set custom windows with setCoefficients().");
+
+            _windowType = windowType;
+            this->_regenerate();
+        }
+
+        size_t windowSize() const
+        {
+            return _windowSize;
+        }
+
+        void setWindowSize(size_t windowSize)
+        {
+            if(0 == windowSize) throw Pothos::InvalidArgumentException("Window size must be non-zero.");
+            if(_windowType == "CUSTOM") throw Pothos::InvalidArgumentException("Custom window size is set by its coefficients.");
+
+            _windowSize = windowSize;
+            this->_regenerate();
+        }
+
+        double kaiserBeta() const
+        {
+            return _kaiserBeta;
+        }
+
+        void setKaiserBeta(double kaiserBeta)
+        {
+            _kaiserBeta = kaiserBeta;
+            if(_windowType == "KAISER") this->_regenerate();
+        }
+
+        std::vector<float> coefficients() const
+        {
+            return _coefficients;
+        }
+
+        void setCoefficients(const std::vector<float>& coefficients)
+        {
+            if(coefficients.empty()) throw Pothos::InvalidArgumentException("Window coefficients cannot be empty.");
+
+            _windowType = "CUSTOM";
+            _windowSize = coefficients.size();
+            _coefficients = coefficients;
+            this->reset();
+        }
+
+        void reset()
+        {
+            _phase = 0;
+        }
+
+        void work() override
+        {
+            const auto elems = this->workInfo().minElements;
+            if(0 == elems) return;
+
+            auto input = this->input(0);
+            auto output = this->output(0);
+
+            const T* inputBuffer = input->buffer();
+            T* outputBuffer = output->buffer();
+
+            // Apply the window in segments, continuing from where the
+            // previous call left off.
+            size_t offset = 0;
+            while(offset < elems)
+            {
+                const auto segmentElems = std::min(elems - offset, _windowSize - _phase);
+
+                _fcn(outputBuffer + offset,
+                     inputBuffer + offset,
+                     _coefficients.data() + _phase,
+                     static_cast<unsigned int>(segmentElems));
+
+                offset += segmentElems;
+                _phase = (_phase + segmentElems) % _windowSize;
+            }
+
+            input->consume(elems);
+            output->produce(elems);
+        }
+
+    private:
+        Fcn _fcn;
+        std::string _windowType;
+        size_t _windowSize;
+        double _kaiserBeta;
+        std::vector<float> _coefficients;
+        size_t _phase;
+
+        void _regenerate()
+        {
+            _coefficients = generateWindow(_windowType, _windowSize, _kaiserBeta);
+            this->reset();
+        }
+};
+
+/***********************************************************************
+ * |PothosDoc Window (VOLK)
+ *
+ * <p>
+ * Multiplies each frame of <b>windowSize</b> inputs by a stored window.
+ * The window's phase is kept aligned across calls, so the first input
+ * is always the start of a frame.
+ * </p>
+ *
+ * <p>
+ * Custom windows can be set with <b>setCoefficients</b>, which also
+ * sets the window size.
+ * </p>
+ *
+ * <p>
+ * Underlying functions:
+ * </p>
+ *
+ * <ul>
+ * <li><b>volk_32f_x2_multiply_32f</b></li>
+ * <li><b>volk_32fc_32f_multiply_32fc</b></li>
+ * </ul>
+ *
+ * |category /Math/VOLK
+ * |category /FFT/VOLK
+ * |category /VOLK/Math
+ * |keywords math fft hann blackman kaiser taper
+ *
+ * |param dtype[Data Type]
+ * |widget DTypeChooser(float32=1,cfloat32=1)
+ * |default "complex_float32"
+ * |preview disable
+ *
+ * |param windowType[Window Type]
+ * |widget ComboBox(editable=false)
+ * |default "HANN"
+ * |option [Rectangular] "RECTANGULAR"
+ * |option [Hann] "HANN"
+ * |option [Blackman] "BLACKMAN"
+ * |option [Kaiser] "KAISER"
+ * |preview enable
+ *
+ * |param windowSize[Window Size]
+ * |widget SpinBox(minimum=1)
+ * |default 1024
+ * |preview enable
+ *
+ * |param kaiserBeta[Kaiser Beta]
+ * Only used by the Kaiser window.
+ * |widget DoubleSpinBox(minimum=0,decimals=3)
+ * |default 6.0
+ * |preview valid
+ *
+ * |factory /volk/window(dtype)
+ * |setter setWindowType(windowType)
+ * |setter setWindowSize(windowSize)
+ * |setter setKaiserBeta(kaiserBeta)
+ **********************************************************************/
+static const std::string VOLKWindowPath = "/volk/window";
+
+static Pothos::Block* makeWindow(const Pothos::DType& dtype)
+{
+    #define IfTypeThenWindow(type,fcn) \
+        if(doesDTypeMatch<type>(dtype)) return Window<type>::make(fcn);
+
+    IfTypeThenWindow(float,volk_32f_x2_multiply_32f)
+    IfTypeThenWindow(std::complex<float>,volk_32fc_32f_multiply_32fc)
+
+    throw InvalidDTypeException(VOLKWindowPath, dtype);
+}
+
+static Pothos::BlockRegistry registerVOLKWindow(
+    VOLKWindowPath,
+    &makeWindow);
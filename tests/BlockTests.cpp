@@ -2,19 +2,28 @@
 // SPDX-License-Identifier: GPL-3.0-or-later
 
 #include "BlockTests.hpp"
+#include "FallbackKernels.hpp"
+#include "HalfKernels.hpp"
 #include "TestUtility.hpp"
+#include "ToDBKernels.hpp"
 
 #include <Pothos/Framework.hpp>
+#include <Pothos/Object/Containers.hpp>
+#include <Pothos/Plugin.hpp>
 #include <Pothos/Testing.hpp>
 
 #include <algorithm>
 #include <climits>
 #include <cmath>
 #include <complex>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
 #include <numeric>
 #include <type_traits>
+#include <utility>
 
 //
 // Utility
@@ -49,12 +58,14 @@ POTHOS_TEST_BLOCK("/volk/tests", test_acos)
 // /volk/accumulator
 //
 
-template <typename T>
-static void testAccumulator(const std::vector<T>& testValues)
+template <typename T, typename PreciseType>
+static void testAccumulator(
+    const std::vector<T>& testValues,
+    const std::string& mode)
 {
     const Pothos::DType dtype(typeid(T));
 
-    std::cout << " * Testing " << dtype.name() << "..." << std::endl;
+    std::cout << " * Testing " << dtype.name() << " (" << mode << ")..." << std::endl;
 
     T sum = std::accumulate(
         testValues.begin(),
@@ -65,6 +76,8 @@ static void testAccumulator(const std::vector<T>& testValues)
     auto accumulator = Pothos::BlockRegistry::make(
         "/volk/accumulator",
         dtype);
+    accumulator.call("setMode", mode);
+    POTHOS_TEST_EQUAL(mode, accumulator.call<std::string>("mode"));
 
     VOLKTests::testOneToOneBlock<T,T>(
         accumulator,
@@ -74,21 +87,123 @@ static void testAccumulator(const std::vector<T>& testValues)
     auto blockSum = accumulator.call<T>("currentSum");
     POTHOS_TEST_EQUAL(sum, blockSum);
 
+    auto preciseSum = accumulator.call<PreciseType>("preciseSum");
+    POTHOS_TEST_EQUAL(PreciseType(sum), preciseSum);
+
     accumulator.call("reset");
     blockSum = accumulator.call<T>("currentSum");
     POTHOS_TEST_EQUAL(T(0), blockSum);
 }
 
+// Floats from 2^25 to 2^26 are multiples of 4, so a float total rounds
+// when the second buffer's sum of 1001 is added, but the higher
+// precision modes keep it.
+static void testAccumulatorPrecision(const std::string& mode)
+{
+    std::cout << " * Testing precision (" << mode << ")..." << std::endl;
+
+    constexpr float largeValue = 33554432.0f; // 2^25
+    const std::vector<float> smallValues(1001, 1.0f);
+
+    auto accumulator = Pothos::BlockRegistry::make(
+        "/volk/accumulator",
+        Pothos::DType(typeid(float)));
+    accumulator.call("setMode", mode);
+
+    VOLKTests::getOneToOneBlockOutputs<float,float>(
+        accumulator,
+        VOLKTests::stdVectorToBufferChunk(std::vector<float>{largeValue}));
+    VOLKTests::getOneToOneBlockOutputs<float,float>(
+        accumulator,
+        VOLKTests::stdVectorToBufferChunk(smallValues));
+
+    const double expectedSum = double(largeValue) + double(smallValues.size());
+    const auto preciseSum = accumulator.call<double>("preciseSum");
+
+    if(mode == "FLOAT") POTHOS_TEST_TRUE(expectedSum != preciseSum);
+    else                POTHOS_TEST_EQUAL(expectedSum, preciseSum);
+}
+
+template <typename T>
+static void testAccumulatorDump(const std::string& dumpMode)
+{
+    const Pothos::DType dtype(typeid(T));
+    constexpr size_t dumpSize = 10;
+
+    std::cout << " * Testing " << dtype.name() << " dump (" << dumpMode << ")..." << std::endl;
+
+    // Enough inputs to span multiple buffers, with a partial final span
+    std::vector<T> inputs;
+    for(size_t i = 0; i < 12345; ++i) inputs.emplace_back(T(float(i % 17) * 0.5f));
+
+    std::vector<T> expectedDumps;
+    for(size_t dump = 0; dump < (inputs.size() / dumpSize); ++dump)
+    {
+        T sum = std::accumulate(
+            inputs.begin() + (dump * dumpSize),
+            inputs.begin() + ((dump + 1) * dumpSize),
+            T(0));
+        if(dumpMode == "MEAN") sum /= T(float(dumpSize));
+
+        expectedDumps.emplace_back(sum);
+    }
+
+    auto accumulator = Pothos::BlockRegistry::make(
+        "/volk/accumulator",
+        dtype);
+    accumulator.call("setDumpSize", dumpSize);
+    accumulator.call("setDumpMode", dumpMode);
+    POTHOS_TEST_EQUAL(dumpSize, accumulator.call<size_t>("dumpSize"));
+    POTHOS_TEST_EQUAL(dumpMode, accumulator.call<std::string>("dumpMode"));
+
+    auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+    source.call("feedBuffer", VOLKTests::stdVectorToBufferChunk(inputs));
+
+    auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+    auto dumpSink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+
+    {
+        Pothos::Topology topology;
+        topology.connect(source, 0, accumulator, 0);
+        topology.connect(accumulator, 0, sink, 0);
+        topology.connect(accumulator, "dump", dumpSink, 0);
+
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+    }
+
+    VOLKTests::testBufferChunks<T>(
+        VOLKTests::stdVectorToBufferChunk(inputs),
+        sink.call<Pothos::BufferChunk>("getBuffer"));
+    VOLKTests::testBufferChunks<T>(
+        VOLKTests::stdVectorToBufferChunk(expectedDumps),
+        dumpSink.call<Pothos::BufferChunk>("getBuffer"));
+}
+
 POTHOS_TEST_BLOCK("/volk/tests", test_accumulator)
 {
-    testAccumulator<float>({
-        10.0f, 20.0f, 30.0f, 40.0f, 50.0f,
-        60.0f, 70.0f, 80.0f, 90.0f, 100.0f
-    });
-    testAccumulator<std::complex<float>>({
-        {10.0f,20.0f}, {30.0f,40.0f}, {50.0f,60.0f},
-        {70.0f,80.0f}, {90.0f,100.0f}
-    });
+    for(const std::string& mode: {"FLOAT", "DOUBLE", "COMPENSATED"})
+    {
+        testAccumulator<float,double>({
+            10.0f, 20.0f, 30.0f, 40.0f, 50.0f,
+            60.0f, 70.0f, 80.0f, 90.0f, 100.0f
+        }, mode);
+        testAccumulator<std::complex<float>,std::complex<double>>({
+            {10.0f,20.0f}, {30.0f,40.0f}, {50.0f,60.0f},
+            {70.0f,80.0f}, {90.0f,100.0f}
+        }, mode);
+    }
+
+    for(const std::string& mode: {"FLOAT", "DOUBLE", "COMPENSATED"})
+    {
+        testAccumulatorPrecision(mode);
+    }
+
+    for(const std::string& dumpMode: {"SUM", "MEAN"})
+    {
+        testAccumulatorDump<float>(dumpMode);
+        testAccumulatorDump<std::complex<float>>(dumpMode);
+    }
 }
 
 //
@@ -145,6 +260,88 @@ POTHOS_TEST_BLOCK("/volk/tests", test_add)
     testAdd<double,double,double>();
     testAdd<std::complex<float>,float,std::complex<float>>();
     testAdd<std::complex<float>,std::complex<float>,std::complex<float>>();
+
+    // Broadcasting float uses the scalar kernel, and double expands the
+    // second input.
+    const Pothos::DType floatDType(typeid(float));
+    const Pothos::DType doubleDType(typeid(double));
+
+    for(size_t broadcastSize: {1, 7, 4099})
+    {
+        VOLKTests::testBroadcastTwoToOneBlock<float>(
+            Pothos::BlockRegistry::make("/volk/add", floatDType, floatDType, floatDType),
+            broadcastSize,
+            std::plus<float>());
+        VOLKTests::testBroadcastTwoToOneBlock<double>(
+            Pothos::BlockRegistry::make("/volk/add", doubleDType, doubleDType, doubleDType),
+            broadcastSize,
+            std::plus<double>());
+    }
+}
+
+//
+// /volk/add_cint16
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_add_cint16)
+{
+    VOLKTests::testTwoToOneBlock<std::complex<int16_t>,std::complex<int16_t>,std::complex<int16_t>,size_t>(
+        Pothos::BlockRegistry::make("/volk/add_cint16"),
+        {{1000,-2000}, {32000,-32000}, {32767,-32768}, {-5,7}, {100,200}},
+        {{500,500},    {1000,-1000},   {1,-1},         {5,-7}, {-300,50}},
+        {{1500,-1500}, {32767,-32768}, {32767,-32768}, {0,0},  {-200,250}},
+        0,
+        1);
+}
+
+//
+// /volk/add_n
+//
+
+// Used by all N-input tests
+template <typename T, typename BinaryOp>
+static void testNToOneBlock(
+    const std::string& blockPath,
+    size_t numInputs,
+    BinaryOp binaryOp)
+{
+    const Pothos::DType dtype(typeid(T));
+
+    std::vector<std::vector<T>> inputs;
+    for(size_t input = 0; input < numInputs; ++input)
+    {
+        inputs.emplace_back();
+        for(size_t i = 0; i < 10; ++i)
+        {
+            inputs.back().emplace_back(T(float((input + (i * 3)) % 7) - 3.0f));
+        }
+    }
+
+    std::vector<T> expectedOutputs(inputs[0]);
+    for(size_t input = 1; input < numInputs; ++input)
+    {
+        std::transform(
+            expectedOutputs.begin(),
+            expectedOutputs.end(),
+            inputs[input].begin(),
+            expectedOutputs.begin(),
+            binaryOp);
+    }
+
+    VOLKTests::testMToNBlock<T,T>(
+        Pothos::BlockRegistry::make(blockPath, dtype, numInputs),
+        inputs,
+        {expectedOutputs});
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_add_n)
+{
+    for(size_t numInputs: {2, 3, 8})
+    {
+        testNToOneBlock<float>("/volk/add_n", numInputs, std::plus<float>());
+        testNToOneBlock<double>("/volk/add_n", numInputs, std::plus<double>());
+        testNToOneBlock<std::complex<float>>("/volk/add_n", numInputs, std::plus<std::complex<float>>());
+    }
 }
 
 //
@@ -285,6 +482,69 @@ POTHOS_TEST_BLOCK("/volk/tests", test_atan2)
         atan2,
         testInputs,
         expectedOutputs);
+
+    for(size_t decimation: {2, 5, 1031})
+    {
+        VOLKTests::testDecimatedOneToOneBlock<std::complex<float>,float>(
+            atan2,
+            decimation,
+            testInputs,
+            expectedOutputs);
+    }
+}
+
+//
+// /volk/benchmark_scaling
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_benchmark_scaling)
+{
+    const std::vector<std::string> chain =
+    {
+        "/volk/convert(complex_int16,complex_float32)",
+        "/volk/multiply_conjugate(complex_float32,complex_float32)",
+        "/volk/magnitude_squared"
+    };
+    constexpr size_t MaxChains = 2;
+
+    const auto plugin = Pothos::PluginRegistry::get("/volk/benchmark_scaling");
+    const auto& benchmarkScaling = plugin.getObject().extract<Pothos::Callable>();
+    const auto report = benchmarkScaling.call<Pothos::ObjectKwargs>(
+        std::string("complex_int16"),
+        chain,
+        MaxChains,
+        0.05);
+
+    // The allocator is chosen per block, so the benchmark doesn't affect
+    // blocks outside of it.
+#ifdef POTHOSVOLK_CUSTOM_BUFFER_ALLOCATOR
+    auto block = Pothos::BlockRegistry::make("/volk/magnitude_squared");
+    POTHOS_TEST_TRUE(block.call<bool>("volkBufferAllocatorEnabled"));
+    block.call("setVOLKBufferAllocatorEnabled", false);
+    POTHOS_TEST_TRUE(!block.call<bool>("volkBufferAllocatorEnabled"));
+#endif
+
+    const auto& allocators = report.at("allocators").extract<Pothos::ObjectKwargs>();
+    POTHOS_TEST_TRUE(allocators.count("default") > 0);
+
+    for(const auto& allocator: allocators)
+    {
+        const auto& results = allocator.second.extract<Pothos::ObjectVector>();
+        POTHOS_TEST_EQUAL(MaxChains, results.size());
+
+        for(size_t i = 0; i < results.size(); ++i)
+        {
+            const auto& result = results[i].extract<Pothos::ObjectKwargs>();
+            POTHOS_TEST_EQUAL(i+1, result.at("numChains").extract<size_t>());
+
+            const auto aggregate = result.at("aggregateElementsPerSecond").extract<double>();
+            POTHOS_TEST_TRUE(aggregate > 0.0);
+
+            std::cout << " * " << allocator.first << ", " << (i+1) << " chain(s): "
+                      << aggregate << " elements/s, "
+                      << result.at("efficiency").extract<double>() << " efficiency" << std::endl;
+        }
+    }
 }
 
 //
@@ -335,7 +595,11 @@ POTHOS_TEST_BLOCK("/volk/tests", test_byteswap)
 
 POTHOS_TEST_BLOCK("/volk/tests", test_calc_spectral_noise_floor)
 {
-    constexpr float spectralExclusionValue = 5.0f;
+    constexpr float spectralExclusionValue = 20.0f;
+    constexpr float cfarMargin = 10.0f;
+    constexpr size_t frameSize = 64;
+    constexpr size_t numFrames = 16;
+    constexpr size_t signalBin = 5;
 
     auto calcSpectralNoiseFloorBlock = Pothos::BlockRegistry::make("/volk/calc_spectral_noise_floor");
     setAndTestValue(
@@ -343,14 +607,167 @@ POTHOS_TEST_BLOCK("/volk/tests", test_calc_spectral_noise_floor)
         spectralExclusionValue,
         "spectralExclusionValue",
         "setSpectralExclusionValue");
+    setAndTestValue(
+        calcSpectralNoiseFloorBlock,
+        frameSize,
+        "frameSize",
+        "setFrameSize");
+    setAndTestValue(
+        calcSpectralNoiseFloorBlock,
+        cfarMargin,
+        "cfarMargin",
+        "setCFARMargin");
+    setAndTestValue(
+        calcSpectralNoiseFloorBlock,
+        true,
+        "cfarEnabled",
+        "setCFAREnabled");
+
+    // A flat -50 dB floor with a single strong bin, which should be
+    // excluded from the noise floor and reported as a detection.
+    std::vector<float> inputs(frameSize * numFrames, -50.0f);
+    for(size_t frame = 0; frame < numFrames; ++frame)
+    {
+        inputs[(frame * frameSize) + signalBin] = 0.0f;
+    }
+
+    // Halfway through, a label raises the exclusion value enough that the
+    // strong bin is averaged into the floor.
+    constexpr size_t labelFrame = numFrames / 2;
+    const float includedFloor = ((-50.0f * (frameSize - 1)) + 0.0f) / frameSize;
+
+    auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", "float32");
+    source.call(
+        "feedLabel",
+        Pothos::Label("setSpectralExclusionValue", 100.0f, labelFrame * frameSize));
+    source.call("feedBuffer", VOLKTests::stdVectorToBufferChunk(inputs));
+
+    auto floorSink = Pothos::BlockRegistry::make("/blocks/collector_sink", "float32");
+    auto detectionSink = Pothos::BlockRegistry::make("/blocks/collector_sink", "uint32");
+
+    {
+        Pothos::Topology topology;
+        topology.connect(source, 0, calcSpectralNoiseFloorBlock, 0);
+        topology.connect(calcSpectralNoiseFloorBlock, 0, floorSink, 0);
+        topology.connect(calcSpectralNoiseFloorBlock, "detections", detectionSink, 0);
+
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+    }
+
+    const auto floors = floorSink.call<Pothos::BufferChunk>("getBuffer");
+    POTHOS_TEST_EQUAL(numFrames, floors.elements());
+    for(size_t frame = 0; frame < numFrames; ++frame)
+    {
+        const float expectedFloor = (frame < labelFrame) ? -50.0f : includedFloor;
+        POTHOS_TEST_CLOSE(expectedFloor, floors.as<const float*>()[frame], 1e-3f);
+    }
+    POTHOS_TEST_CLOSE(
+        includedFloor,
+        calcSpectralNoiseFloorBlock.call<float>("noiseFloor"),
+        1e-3f);
+    POTHOS_TEST_EQUAL(100.0f, calcSpectralNoiseFloorBlock.call<float>("spectralExclusionValue"));
+
+    for(const auto& label: floorSink.call<std::vector<Pothos::Label>>("getLabels"))
+    {
+        POTHOS_TEST_TRUE(label.id != "setSpectralExclusionValue");
+    }
+
+    const auto detections = detectionSink.call<std::vector<Pothos::Object>>("getMessages");
+    POTHOS_TEST_EQUAL(numFrames, detections.size());
+    for(const auto& detection: detections)
+    {
+        const auto& packet = detection.extract<Pothos::Packet>();
+        POTHOS_TEST_EQUAL(size_t(1), packet.payload.elements());
+        POTHOS_TEST_EQUAL(signalBin, packet.payload.as<const uint32_t*>()[0]);
+    }
+}
+
+//
+// /volk/characterize
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_characterize)
+{
+    const std::vector<size_t> sizes = {64, 1024};
+
+    const auto plugin = Pothos::PluginRegistry::get("/volk/characterize");
+    const auto& characterize = plugin.getObject().extract<Pothos::Callable>();
+    const auto report = characterize.call<Pothos::ObjectKwargs>(
+        std::string("^volk_32f_(sqrt|x2_divide)_32f$"),
+        size_t(4096),
+        sizes,
+        0.001);
+
+    POTHOS_TEST_EQUAL(size_t(4096), report.at("sweepPoints").extract<size_t>());
+
+    const auto& kernels = report.at("kernels").extract<Pothos::ObjectVector>();
+    POTHOS_TEST_EQUAL(size_t(2), kernels.size());
+
+    for(const auto& kernelObj: kernels)
+    {
+        const auto& kernel = kernelObj.extract<Pothos::ObjectKwargs>();
+        const auto& impls = kernel.at("implementations").extract<Pothos::ObjectVector>();
+        POTHOS_TEST_TRUE(!impls.empty());
+
+        std::cout << " * " << kernel.at("name").extract<std::string>() << std::endl;
+
+        bool foundGeneric = false;
+        for(const auto& implObj: impls)
+        {
+            const auto& impl = implObj.extract<Pothos::ObjectKwargs>();
+            const auto implName = impl.at("name").extract<std::string>();
+            const auto maxULP = impl.at("maxULP").extract<double>();
+
+            std::cout << "   * " << implName << ": " << maxULP << " max ULP" << std::endl;
+
+            const auto& throughputs = impl.at("throughput").extract<Pothos::ObjectVector>();
+            POTHOS_TEST_EQUAL(sizes.size(), throughputs.size());
+            for(const auto& throughput: throughputs)
+            {
+                POTHOS_TEST_TRUE(throughput.extract<Pothos::ObjectKwargs>().at("pointsPerSecond").extract<double>() > 0.0);
+            }
+
+            // Both kernels' generic implementations are correctly rounded.
+            if(implName == "generic")
+            {
+                foundGeneric = true;
+                POTHOS_TEST_TRUE(maxULP <= 0.5001);
+                POTHOS_TEST_EQUAL(size_t(0), impl.at("nonFinite").extract<size_t>());
+            }
+        }
+        POTHOS_TEST_TRUE(foundGeneric);
+    }
+}
+
+//
+// /volk/clamp
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_clamp)
+{
+    constexpr float lowerBound = -0.5f;
+    constexpr float upperBound = 2.0f;
+
+    auto clampBlock = Pothos::BlockRegistry::make("/volk/clamp");
+    setAndTestValue(
+        clampBlock,
+        lowerBound,
+        "lowerBound",
+        "setLowerBound");
+    setAndTestValue(
+        clampBlock,
+        upperBound,
+        "upperBound",
+        "setUpperBound");
+
+    const std::vector<float> inputs{-3.0f, -0.5f, -0.25f, 0.0f, 1.5f, 2.0f, 2.5f, 100.0f};
+    const std::vector<float> expectedOutputs{-0.5f, -0.5f, -0.25f, 0.0f, 1.5f, 2.0f, 2.0f, 2.0f};
 
-    // Just make sure the block executes
     VOLKTests::testOneToOneBlock<float,float>(
-        calcSpectralNoiseFloorBlock,
-        {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10},
-        {},
-        false /*lax*/,
-        false /*testOutputs*/);
+        clampBlock,
+        inputs,
+        expectedOutputs);
 }
 
 //
@@ -365,6 +782,18 @@ POTHOS_TEST_BLOCK("/volk/tests", test_conjugate)
         {{0.0f,-1.0f}, {2.0f,-3.0f}, {4.0f,-5.0f}});
 }
 
+//
+// /volk/conjugate_cint16
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_conjugate_cint16)
+{
+    VOLKTests::testOneToOneBlock<std::complex<int16_t>,std::complex<int16_t>>(
+        Pothos::BlockRegistry::make("/volk/conjugate_cint16"),
+        {{1,2},  {-3,-4}, {5,-32768}, {32767,32767}},
+        {{1,-2}, {-3,4},  {5,32767},  {32767,-32767}});
+}
+
 //
 // /volk/convert
 //
@@ -401,6 +830,74 @@ POTHOS_TEST_BLOCK("/volk/tests", test_convert)
         {0, 1, 2, 3, 4, 5, 127});
 }
 
+//
+// /volk/convert_half
+//
+
+// Half-precision values are stored as uint16, so this tests both
+// directions with values that survive the round trip.
+template <typename FloatType, typename HalfType>
+static void testConvertHalf(
+    const std::string& format,
+    const std::vector<FloatType>& floats,
+    const std::vector<HalfType>& halves)
+{
+    const Pothos::DType floatDType(typeid(FloatType));
+    const Pothos::DType halfDType(typeid(HalfType));
+
+    std::cout << " * Testing " << floatDType.name()
+              << " <-> " << halfDType.name()
+              << " (" << format << ")..." << std::endl;
+
+    auto toHalf = Pothos::BlockRegistry::make(
+        "/volk/convert_half",
+        floatDType,
+        halfDType,
+        format);
+
+    VOLKTests::testOneToOneBlock<FloatType,HalfType>(
+        toHalf,
+        floats,
+        halves);
+
+    auto fromHalf = Pothos::BlockRegistry::make(
+        "/volk/convert_half",
+        halfDType,
+        floatDType,
+        format);
+
+    VOLKTests::testOneToOneBlock<HalfType,FloatType>(
+        fromHalf,
+        halves,
+        floats);
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_convert_half)
+{
+    testConvertHalf<float,uint16_t>(
+        "FLOAT16",
+        {1.0f,   0.5f,   -2.0f,  65504.0f, 0.333251953125f, 0.0f},
+        {0x3C00, 0x3800, 0xC000, 0x7BFF,   0x3555,          0x0000});
+    testConvertHalf<float,uint16_t>(
+        "BFLOAT16",
+        {1.0f,   0.5f,   -2.0f,  65536.0f, 0.333984375f, 0.0f},
+        {0x3F80, 0x3F00, 0xC000, 0x4780,   0x3EAB,       0x0000});
+    testConvertHalf<std::complex<float>,std::complex<uint16_t>>(
+        "FLOAT16",
+        {{1.0f,-2.0f},     {0.5f,65504.0f}},
+        {{0x3C00,0xC000},  {0x3800,0x7BFF}});
+    testConvertHalf<std::complex<float>,std::complex<uint16_t>>(
+        "BFLOAT16",
+        {{1.0f,-2.0f},     {0.5f,65536.0f}},
+        {{0x3F80,0xC000},  {0x3F00,0x4780}});
+
+    // Rounds to nearest even
+    VOLKTests::testOneToOneBlock<float,uint16_t>(
+        Pothos::BlockRegistry::make("/volk/convert_half", "float32", "uint16", "FLOAT16"),
+        {1.0f/3.0f, 1.00048828125f, 1.00146484375f, 1e6f},
+        {0x3555,    0x3C00,         0x3C02,         0x7C00});
+}
+
 //
 // /volk/convert_scaled
 //
@@ -456,6 +953,98 @@ POTHOS_TEST_BLOCK("/volk/tests", test_convert_scaled)
         {1500,  25000, 350000, 4250000, 50000000},
         {1.5e1, 2.5e2, 3.5e3,  4.25e4,  5e5},
         100.0f);
+
+    std::cout << " * Testing float32 -> int16 (clamped)..." << std::endl;
+
+    auto clampedBlock = Pothos::BlockRegistry::make(
+        "/volk/convert_scaled",
+        Pothos::DType(typeid(float)),
+        Pothos::DType(typeid(int16_t)));
+    setAndTestValue(clampedBlock, 10000.0f);
+    setAndTestValue(clampedBlock, -0.5f, "lowerBound", "setLowerBound");
+    setAndTestValue(clampedBlock, 0.5f, "upperBound", "setUpperBound");
+    clampedBlock.call("setClampEnabled", true);
+    POTHOS_TEST_TRUE(clampedBlock.call<bool>("clampEnabled"));
+
+    VOLKTests::testOneToOneBlock<float,int16_t>(
+        clampedBlock,
+        {-4.0f, -0.5f, -0.1f, 0.25f, 0.5f, 3.0f},
+        {-5000, -5000, -1000, 2500,  5000, 5000});
+}
+
+//
+// /volk/correlator
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_correlator)
+{
+    // Barker-13, rotated and scaled differently at each location
+    const std::vector<float> barker13{1,1,1,1,1,-1,-1,1,1,-1,1,-1,1};
+    const std::vector<std::complex<float>> preamble(barker13.begin(), barker13.end());
+    const std::vector<size_t> preambleStarts{300, 700};
+    const std::vector<std::complex<float>> preambleGains{{2.0f,0.0f}, {0.0f,-0.5f}};
+
+    // Low-level filler uncorrelated with the preamble
+    std::vector<std::complex<float>> inputs;
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        inputs.emplace_back(0.05f * std::cos(0.37f * i), 0.05f * std::sin(0.91f * i));
+    }
+    for(size_t i = 0; i < preambleStarts.size(); ++i)
+    {
+        for(size_t j = 0; j < preamble.size(); ++j)
+        {
+            inputs[preambleStarts[i] + j] = preamble[j] * preambleGains[i];
+        }
+    }
+
+    auto correlator = Pothos::BlockRegistry::make("/volk/correlator");
+    correlator.call("setPreamble", preamble);
+    setAndTestValue(correlator, 0.9f, "threshold", "setThreshold");
+    correlator.call("setLabelID", "found");
+
+    const Pothos::DType dtype(typeid(std::complex<float>));
+
+    auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+    source.call("feedBuffer", VOLKTests::stdVectorToBufferChunk(inputs));
+
+    auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+    auto detectionSink = Pothos::BlockRegistry::make("/blocks/collector_sink", "uint8");
+
+    {
+        Pothos::Topology topology;
+        topology.connect(source, 0, correlator, 0);
+        topology.connect(correlator, 0, sink, 0);
+        topology.connect(correlator, "detections", detectionSink, 0);
+
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+    }
+
+    // The stream should be passed through unchanged.
+    VOLKTests::testBufferChunks<std::complex<float>>(
+        VOLKTests::stdVectorToBufferChunk(inputs),
+        sink.call<Pothos::BufferChunk>("getBuffer"));
+
+    const auto labels = sink.call<std::vector<Pothos::Label>>("getLabels");
+    POTHOS_TEST_EQUAL(preambleStarts.size(), labels.size());
+
+    const auto detections = detectionSink.call<std::vector<Pothos::Object>>("getMessages");
+    POTHOS_TEST_EQUAL(preambleStarts.size(), detections.size());
+
+    for(size_t i = 0; i < preambleStarts.size(); ++i)
+    {
+        POTHOS_TEST_EQUAL("found", labels[i].id);
+        POTHOS_TEST_EQUAL(preambleStarts[i] + preamble.size() - 1, labels[i].index);
+
+        const auto& metadata = detections[i].extract<Pothos::Packet>().metadata;
+        POTHOS_TEST_EQUAL(preambleStarts[i], metadata.at("index").convert<size_t>());
+        POTHOS_TEST_TRUE(metadata.at("metric").convert<float>() >= 0.9f);
+        POTHOS_TEST_CLOSE(
+            std::arg(preambleGains[i]),
+            metadata.at("phase").convert<float>(),
+            1e-2f);
+    }
 }
 
 //
@@ -715,6 +1304,22 @@ POTHOS_TEST_BLOCK("/volk/tests", test_divide)
         {{-3.0f,-2.0f},  {-1.0f,1.0f},          {2.0f,3.0f}},
         {{0.5f,-0.25f},  {0.125f,-8.0f},        {4.0f,-2.0f}},
         {{-3.2f,-5.6f},  {-0.12692f,-0.12301f}, {0.1f,0.8f}});
+
+    auto divide = Pothos::BlockRegistry::make("/volk/divide", "float32");
+    for(size_t decimation: {2, 5, 1031})
+    {
+        VOLKTests::testDecimatedTwoToOneBlock<float>(
+            divide,
+            decimation,
+            {-3.0f, -2.0f,  -1.0f,  1.0f,    2.0f, 3.0f},
+            {0.5f,  -0.25f, 0.125f, -8.0f,   4.0f, -2.0f},
+            {-6.0f, 8.0f,   -8.0f,  -0.125f, 0.5f, -1.5f});
+    }
+
+    // Decimation and broadcasting can't be combined.
+    POTHOS_TEST_THROWS(
+        divide.call("setBroadcastSize", size_t(4)),
+        Pothos::ProxyExceptionMessage);
 }
 
 //
@@ -739,52 +1344,539 @@ POTHOS_TEST_BLOCK("/volk/tests", test_exp)
 }
 
 //
-// /volk/interleave
+// Fallback kernels
 //
 
-POTHOS_TEST_BLOCK("/volk/tests", test_interleave)
+// Not a multiple of any vector width, so each tail is tested
+static constexpr unsigned int NumFallbackPoints = 1027;
+
+static void testFallbackKernels(
+    const std::string& arch,
+    const Fallback::KernelTable& generic,
+    const Fallback::KernelTable& kernels)
 {
-    VOLKTests::testTwoToOneBlock<float,float,std::complex<float>,std::string>(
-        Pothos::BlockRegistry::make("/volk/interleave"),
-        {-2.5f,         -0.5f,        1.5f},
-        {-1.5f,         0.5f,         2.5f},
-        {{-2.5f,-1.5f}, {-0.5f,0.5f}, {1.5f,2.5f}},
-        "real",
-        "imag");
-}
+    std::cout << " * Testing " << arch << std::endl;
 
-//
-// /volk/interleave_scaled
-//
+    std::vector<float> floats0, floats1;
+    std::vector<short> shorts0, shorts1, shorts2, shorts3, shorts4;
+    for(unsigned int i = 0; i < (NumFallbackPoints * 2); ++i)
+    {
+        floats0.emplace_back(std::sin(float(i) * 0.1f) * 40.0f);
+        floats1.emplace_back(std::cos(float(i) * 0.37f) * 5.0f);
+    }
+    for(unsigned int i = 0; i < NumFallbackPoints; ++i)
+    {
+        // Small enough that no differences overflow in the max* kernels
+        shorts0.emplace_back(short(int((i * 7919) % 16001) - 8000));
+        shorts1.emplace_back(short(int((i * 104729) % 16001) - 8000));
+        shorts2.emplace_back(short(int((i * 15485863) % 16001) - 8000));
+        shorts3.emplace_back(short(int((i * 32452843) % 16001) - 8000));
+        shorts4.emplace_back(short(int((i * 49979687) % 16001) - 8000));
+    }
 
-POTHOS_TEST_BLOCK("/volk/tests", test_interleave_scaled)
-{
-    constexpr float scalar = 100.0f;
+    const auto* complex0 = reinterpret_cast<const lv_32fc_t*>(floats0.data());
+    const auto* complex1 = reinterpret_cast<const lv_32fc_t*>(floats1.data());
 
-    auto interleaveScaledBlock = Pothos::BlockRegistry::make("/volk/interleave_scaled");
-    setAndTestValue(interleaveScaledBlock, scalar);
+    //
+    // Float kernels
+    //
 
-    VOLKTests::testTwoToOneBlock<float,float,std::complex<int16_t>,std::string>(
-        interleaveScaledBlock,
-        {-2.5f,       -0.5f,    1.5f},
-        {-1.5f,       0.5f,     2.5f},
-        {{-250,-150}, {-50,50}, {150,250}},
-        "real",
-        "imag");
-}
+    std::vector<float> expectedFloats(NumFallbackPoints * 2);
+    std::vector<float> actualFloats(NumFallbackPoints * 2);
 
-//
-// /volk/invsqrt
-//
+    generic.volk_32f_s32f_add_32f(expectedFloats.data(), floats0.data(), 1.5f, NumFallbackPoints);
+    kernels.volk_32f_s32f_add_32f(actualFloats.data(), floats0.data(), 1.5f, NumFallbackPoints);
+    POTHOS_TEST_EQUALA(expectedFloats.data(), actualFloats.data(), NumFallbackPoints);
 
-POTHOS_TEST_BLOCK("/volk/tests", test_invsqrt)
-{
+    generic.volk_32f_s32f_x2_clamp_32f(expectedFloats.data(), floats0.data(), -10.0f, 20.0f, NumFallbackPoints);
+    kernels.volk_32f_s32f_x2_clamp_32f(actualFloats.data(), floats0.data(), -10.0f, 20.0f, NumFallbackPoints);
+    POTHOS_TEST_EQUALA(expectedFloats.data(), actualFloats.data(), NumFallbackPoints);
+
+    // The vectorized exp is accurate to a few ULPs, so compare relative
+    // to each output.
+    generic.volk_32f_exp_32f(expectedFloats.data(), floats0.data(), NumFallbackPoints);
+    kernels.volk_32f_exp_32f(actualFloats.data(), floats0.data(), NumFallbackPoints);
+    for(unsigned int i = 0; i < NumFallbackPoints; ++i)
+    {
+        POTHOS_TEST_CLOSE(1.0f, actualFloats[i] / expectedFloats[i], 1e-6f);
+    }
+
+    //
+    // Complex kernels
+    //
+
+    const lv_32fc_t scalar(0.5f, -1.25f);
+    generic.volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+        reinterpret_cast<lv_32fc_t*>(expectedFloats.data()),
+        complex0,
+        complex1,
+        scalar,
+        NumFallbackPoints);
+    kernels.volk_32fc_x2_s32fc_multiply_conjugate_add_32fc(
+        reinterpret_cast<lv_32fc_t*>(actualFloats.data()),
+        complex0,
+        complex1,
+        scalar,
+        NumFallbackPoints);
+    POTHOS_TEST_CLOSEA(expectedFloats.data(), actualFloats.data(), 1e-4f, (NumFallbackPoints * 2));
+
+    // The vectorized sum adds in a different order.
+    lv_32fc_t expectedSum, actualSum;
+    generic.volk_32fc_accumulator_s32fc(&expectedSum, complex0, NumFallbackPoints);
+    kernels.volk_32fc_accumulator_s32fc(&actualSum, complex0, NumFallbackPoints);
+    POTHOS_TEST_CLOSE(expectedSum.real(), actualSum.real(), 1e-2f);
+    POTHOS_TEST_CLOSE(expectedSum.imag(), actualSum.imag(), 1e-2f);
+
+    //
+    // int16 kernels, which should match exactly
+    //
+
+    short expectedMax = 0, actualMax = 0;
+    generic.volk_16i_max_star_16i(&expectedMax, shorts0.data(), NumFallbackPoints);
+    kernels.volk_16i_max_star_16i(&actualMax, shorts0.data(), NumFallbackPoints);
+    POTHOS_TEST_EQUAL(expectedMax, actualMax);
+
+    std::vector<std::vector<short>> expectedShorts(4, std::vector<short>(NumFallbackPoints));
+    std::vector<std::vector<short>> actualShorts(4, std::vector<short>(NumFallbackPoints));
+
+    generic.volk_16i_x4_quad_max_star_16i(
+        expectedShorts[0].data(),
+        shorts0.data(), shorts1.data(), shorts2.data(), shorts3.data(),
+        NumFallbackPoints);
+    kernels.volk_16i_x4_quad_max_star_16i(
+        actualShorts[0].data(),
+        shorts0.data(), shorts1.data(), shorts2.data(), shorts3.data(),
+        NumFallbackPoints);
+    POTHOS_TEST_EQUALV(expectedShorts[0], actualShorts[0]);
+
+    generic.volk_16i_x5_add_quad_16i_x4(
+        expectedShorts[0].data(), expectedShorts[1].data(), expectedShorts[2].data(), expectedShorts[3].data(),
+        shorts0.data(), shorts1.data(), shorts2.data(), shorts3.data(), shorts4.data(),
+        NumFallbackPoints);
+    kernels.volk_16i_x5_add_quad_16i_x4(
+        actualShorts[0].data(), actualShorts[1].data(), actualShorts[2].data(), actualShorts[3].data(),
+        shorts0.data(), shorts1.data(), shorts2.data(), shorts3.data(), shorts4.data(),
+        NumFallbackPoints);
+    for(size_t i = 0; i < expectedShorts.size(); ++i)
+    {
+        POTHOS_TEST_EQUALV(expectedShorts[i], actualShorts[i]);
+    }
+}
+
+// The module's fallbacks are always built, so they can be tested against
+// the generic versions regardless of the installed VOLK.
+POTHOS_TEST_BLOCK("/volk/tests", test_fallback_kernels)
+{
+    const auto tables = Fallback::getSupportedKernelTables();
+    POTHOS_TEST_EQUAL("generic", tables.front().first);
+
+    for(const auto& table: tables)
+    {
+        testFallbackKernels(table.first, tables.front().second, table.second);
+    }
+}
+
+//
+// /volk/fma
+//
+
+static void getFMATestInputs(
+    std::vector<float>& inputs0,
+    std::vector<float>& inputs1,
+    std::vector<float>& inputs2)
+{
+    for(size_t i = 0; i < 10; ++i)
+    {
+        inputs0.emplace_back((float(i) - 4.5f) * 0.5f);
+        inputs1.emplace_back(1.5f - (float(i) * 0.25f));
+        inputs2.emplace_back(float(i * i) * 0.125f);
+    }
+}
+
+static void getFMATestInputs(
+    std::vector<std::complex<float>>& inputs0,
+    std::vector<std::complex<float>>& inputs1,
+    std::vector<std::complex<float>>& inputs2)
+{
+    std::vector<float> real0, real1, real2;
+    getFMATestInputs(real0, real1, real2);
+
+    // Reverse the imaginary parts so each complex product has cross terms.
+    for(size_t i = 0; i < real0.size(); ++i)
+    {
+        const auto j = real0.size() - 1 - i;
+        inputs0.emplace_back(real0[i], real1[j]);
+        inputs1.emplace_back(real1[i], real2[j]);
+        inputs2.emplace_back(real2[i], real0[j]);
+    }
+}
+
+template <typename T>
+static void testFMA()
+{
+    std::vector<T> inputs0, inputs1, inputs2, expectedOutputs;
+    getFMATestInputs(inputs0, inputs1, inputs2);
+    for(size_t i = 0; i < inputs0.size(); ++i)
+    {
+        expectedOutputs.emplace_back((inputs0[i] * inputs1[i]) + inputs2[i]);
+    }
+
+    VOLKTests::testMToNBlock<T,T>(
+        Pothos::BlockRegistry::make("/volk/fma", Pothos::DType(typeid(T))),
+        {inputs0, inputs1, inputs2},
+        {expectedOutputs});
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_fma)
+{
+    testFMA<float>();
+    testFMA<std::complex<float>>();
+}
+
+//
+// /volk/fma_scalar
+//
+
+template <typename T>
+static void testFMAScalar(const T& scalar)
+{
+    const Pothos::DType dtype(typeid(T));
+
+    std::cout << "Testing " << dtype.name() << "..." << std::endl;
+
+    std::vector<T> inputs0, inputs1, inputs2, expectedOutputs;
+    getFMATestInputs(inputs0, inputs1, inputs2);
+    for(size_t i = 0; i < inputs0.size(); ++i)
+    {
+        expectedOutputs.emplace_back((inputs0[i] * inputs1[i]) + scalar);
+    }
+
+    auto fmaScalar = Pothos::BlockRegistry::make("/volk/fma_scalar", dtype);
+    setAndTestValue(fmaScalar, scalar);
+
+    VOLKTests::testTwoToOneBlock<T,T,T,size_t>(
+        fmaScalar,
+        inputs0,
+        inputs1,
+        expectedOutputs,
+        0,
+        1);
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_fma_scalar)
+{
+    testFMAScalar<float>(-1.25f);
+    testFMAScalar<std::complex<float>>({0.5f, -2.0f});
+}
+
+//
+// Half-precision kernels
+//
+
+static uint32_t floatBits(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+static float bitsFloat(uint32_t bits)
+{
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// NaNs never compare equal, so floats are compared by their bits.
+static std::vector<uint32_t> floatVectorBits(const std::vector<float>& floats)
+{
+    std::vector<uint32_t> bits;
+    std::transform(floats.begin(), floats.end(), std::back_inserter(bits), &floatBits);
+    return bits;
+}
+
+static void testHalfKernels(
+    const std::string& arch,
+    const Half::KernelTable& generic,
+    const Half::KernelTable& kernels)
+{
+    std::cout << " * Testing " << arch << std::endl;
+
+    // Covers normal, subnormal, overflowing, tied and NaN values in both
+    // formats
+    std::vector<float> floats;
+    for(unsigned int i = 0; i < NumFallbackPoints; ++i)
+    {
+        floats.emplace_back(std::sin(float(i) * 0.1f) * std::pow(2.0f, float(int(i % 48) - 28)));
+    }
+    floats[0] = std::numeric_limits<float>::infinity();
+    floats[1] = -std::numeric_limits<float>::infinity();
+    floats[2] = 65520.0f;
+    floats[3] = 1.00048828125f;
+    floats[4] = bitsFloat(0x7F812345); // Signaling, with a payload
+    floats[5] = bitsFloat(0xFFC0ABCD);
+
+    std::vector<uint16_t> halves(NumFallbackPoints);
+    std::iota(halves.begin(), halves.end(), uint16_t(0x3000));
+    halves[0] = 0x7C01; // Signaling, with a payload
+    halves[1] = 0xFE55;
+
+    std::vector<uint16_t> expectedHalves(NumFallbackPoints), actualHalves(NumFallbackPoints);
+    std::vector<float> expectedFloats(NumFallbackPoints), actualFloats(NumFallbackPoints);
+
+    generic.floatToFloat16(expectedHalves.data(), floats.data(), NumFallbackPoints);
+    kernels.floatToFloat16(actualHalves.data(), floats.data(), NumFallbackPoints);
+    POTHOS_TEST_EQUALV(expectedHalves, actualHalves);
+
+    generic.floatToBFloat16(expectedHalves.data(), floats.data(), NumFallbackPoints);
+    kernels.floatToBFloat16(actualHalves.data(), floats.data(), NumFallbackPoints);
+    POTHOS_TEST_EQUALV(expectedHalves, actualHalves);
+
+    generic.float16ToFloat(expectedFloats.data(), halves.data(), NumFallbackPoints);
+    kernels.float16ToFloat(actualFloats.data(), halves.data(), NumFallbackPoints);
+    POTHOS_TEST_EQUALV(floatVectorBits(expectedFloats), floatVectorBits(actualFloats));
+
+    generic.bfloat16ToFloat(expectedFloats.data(), halves.data(), NumFallbackPoints);
+    kernels.bfloat16ToFloat(actualFloats.data(), halves.data(), NumFallbackPoints);
+    POTHOS_TEST_EQUALV(floatVectorBits(expectedFloats), floatVectorBits(actualFloats));
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_half_kernels)
+{
+    const auto tables = Half::getSupportedKernelTables();
+    POTHOS_TEST_EQUAL("generic", tables.front().first);
+
+    // As in F16C, NaNs are quieted and keep the upper bits of their
+    // payload.
+    const std::vector<float> nans{bitsFloat(0x7F812345), bitsFloat(0xFFC0ABCD)};
+    std::vector<uint16_t> halfNaNs(nans.size());
+    tables.front().second.floatToFloat16(halfNaNs.data(), nans.data(), nans.size());
+    POTHOS_TEST_EQUALV(std::vector<uint16_t>({0x7E09, 0xFE05}), halfNaNs);
+
+    std::vector<float> floatNaNs(halfNaNs.size());
+    const std::vector<uint16_t> signalingHalfNaNs{0x7C01, 0xFC55};
+    tables.front().second.float16ToFloat(floatNaNs.data(), signalingHalfNaNs.data(), signalingHalfNaNs.size());
+    POTHOS_TEST_EQUALV(std::vector<uint32_t>({0x7FC02000, 0xFFCAA000}), floatVectorBits(floatNaNs));
+
+    for(const auto& table: tables)
+    {
+        testHalfKernels(table.first, tables.front().second, table.second);
+    }
+}
+
+//
+// /volk/info
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_info)
+{
+    const auto plugin = Pothos::PluginRegistry::get("/volk/info");
+    const auto& getInfo = plugin.getObject().extract<Pothos::Callable>();
+    const auto info = getInfo.call<Pothos::ObjectKwargs>();
+
+    std::cout << " * Machine: " << info.at("machine").extract<std::string>() << std::endl;
+    POTHOS_TEST_TRUE(info.at("alignment").convert<size_t>() > 0);
+    POTHOS_TEST_TRUE(info.count("configPath") > 0);
+    const auto fallbackArch = info.at("fallbackArch").extract<std::string>();
+    std::cout << " * Fallback arch: " << fallbackArch << std::endl;
+    std::cout << " * Half arch: " << info.at("halfArch").extract<std::string>() << std::endl;
+
+    const auto& kernels = info.at("kernels").extract<Pothos::ObjectVector>();
+    POTHOS_TEST_TRUE(!kernels.empty());
+
+    bool foundAdd = false;
+    for(const auto& kernelObj: kernels)
+    {
+        const auto& kernel = kernelObj.extract<Pothos::ObjectKwargs>();
+        const auto& implNames = kernel.at("implementations").extract<std::vector<std::string>>();
+        const auto selectedAligned = kernel.at("selectedAligned").extract<std::string>();
+        const auto selectedUnaligned = kernel.at("selectedUnaligned").extract<std::string>();
+
+        // Selected implementations must be available, unless the
+        // module's own fallback is used.
+        if(kernel.at("fallback").extract<bool>())
+        {
+            POTHOS_TEST_TRUE(implNames.empty());
+            POTHOS_TEST_EQUAL(fallbackArch, selectedAligned);
+            POTHOS_TEST_EQUAL(fallbackArch, selectedUnaligned);
+            POTHOS_TEST_EQUAL(
+                (fallbackArch == "generic"),
+                kernel.at("selectedGeneric").extract<bool>());
+        }
+        else
+        {
+            POTHOS_TEST_TRUE(std::find(implNames.begin(), implNames.end(), selectedAligned) != implNames.end());
+            POTHOS_TEST_TRUE(std::find(implNames.begin(), implNames.end(), selectedUnaligned) != implNames.end());
+        }
+
+        if(kernel.at("name").extract<std::string>() == "volk_32f_x2_add_32f")
+        {
+            foundAdd = true;
+            POTHOS_TEST_TRUE(std::find(implNames.begin(), implNames.end(), "generic") != implNames.end());
+        }
+    }
+    POTHOS_TEST_TRUE(foundAdd);
+}
+
+//
+// /volk/interleave
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_interleave)
+{
+    VOLKTests::testTwoToOneBlock<float,float,std::complex<float>,std::string>(
+        Pothos::BlockRegistry::make("/volk/interleave"),
+        {-2.5f,         -0.5f,        1.5f},
+        {-1.5f,         0.5f,         2.5f},
+        {{-2.5f,-1.5f}, {-0.5f,0.5f}, {1.5f,2.5f}},
+        "real",
+        "imag");
+}
+
+//
+// /volk/interleave_scaled
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_interleave_scaled)
+{
+    constexpr float scalar = 100.0f;
+
+    auto interleaveScaledBlock = Pothos::BlockRegistry::make("/volk/interleave_scaled");
+    setAndTestValue(interleaveScaledBlock, scalar);
+
+    VOLKTests::testTwoToOneBlock<float,float,std::complex<int16_t>,std::string>(
+        interleaveScaledBlock,
+        {-2.5f,       -0.5f,    1.5f},
+        {-1.5f,       0.5f,     2.5f},
+        {{-250,-150}, {-50,50}, {150,250}},
+        "real",
+        "imag");
+}
+
+//
+// /volk/invsqrt
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_invsqrt)
+{
     VOLKTests::testOneToOneBlock<float,float>(
         Pothos::BlockRegistry::make("/volk/invsqrt"),
         {0.125f,    0.5f,      2.0f},
         {2.828427f, 1.414213f, 0.707106f});
 }
 
+//
+// /volk/iq_ingest
+//
+
+template <typename InType>
+static void testIQIngest(
+    const std::string& format,
+    const std::vector<InType>& inputsVec,
+    const std::vector<std::complex<float>>& expectedOutputs)
+{
+    const auto inputs = VOLKTests::stdVectorToBufferChunk(inputsVec);
+
+    std::cout << " * Testing " << format << "..." << std::endl;
+
+    auto iqIngest = Pothos::BlockRegistry::make("/volk/iq_ingest", format);
+    POTHOS_TEST_EQUAL(format, iqIngest.call<std::string>("format"));
+
+    auto outputs = VOLKTests::getOneToOneBlockOutputs<InType,std::complex<float>>(
+        iqIngest,
+        inputs);
+    VOLKTests::testBufferChunks<std::complex<float>>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        outputs);
+
+    std::cout << " * Testing " << format << " (IQ swap)..." << std::endl;
+
+    setAndTestValue(iqIngest, true, "iqSwap", "setIQSwap");
+
+    std::vector<std::complex<float>> expectedSwappedOutputs;
+    for(const auto& output: expectedOutputs) expectedSwappedOutputs.emplace_back(output.imag(), output.real());
+
+    outputs = VOLKTests::getOneToOneBlockOutputs<InType,std::complex<float>>(
+        iqIngest,
+        inputs);
+    VOLKTests::testBufferChunks<std::complex<float>>(
+        VOLKTests::stdVectorToBufferChunk(expectedSwappedOutputs),
+        outputs);
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_iq_ingest)
+{
+    constexpr size_t numSamples = 1000;
+
+    std::vector<std::complex<int8_t>> cs8Inputs;
+    std::vector<std::complex<float>> cs8ExpectedOutputs;
+    std::vector<std::complex<int16_t>> cs16Inputs;
+    std::vector<std::complex<float>> cs16ExpectedOutputs;
+    std::vector<uint8_t> cs12Inputs;
+    std::vector<std::complex<float>> cs12ExpectedOutputs;
+
+    for(size_t i = 0; i < numSamples; ++i)
+    {
+        const int i8 = int(i % 256) - 128;
+        const int q8 = 127 - int(i % 256);
+        cs8Inputs.emplace_back(int8_t(i8), int8_t(q8));
+        cs8ExpectedOutputs.emplace_back(i8 / 128.0f, q8 / 128.0f);
+
+        const int i16 = (int(i) * 61) - 30000;
+        const int q16 = 30000 - (int(i) * 59);
+        cs16Inputs.emplace_back(int16_t(i16), int16_t(q16));
+        cs16ExpectedOutputs.emplace_back(i16 / 32768.0f, q16 / 32768.0f);
+
+        const int i12 = int(i % 4096) - 2048;
+        const int q12 = 2047 - int((i * 3) % 4096);
+        const uint16_t i12Bits = uint16_t(i12) & 0xFFF;
+        const uint16_t q12Bits = uint16_t(q12) & 0xFFF;
+        cs12Inputs.emplace_back(uint8_t(i12Bits & 0xFF));
+        cs12Inputs.emplace_back(uint8_t((i12Bits >> 8) | ((q12Bits & 0xF) << 4)));
+        cs12Inputs.emplace_back(uint8_t(q12Bits >> 4));
+        cs12ExpectedOutputs.emplace_back(i12 / 2048.0f, q12 / 2048.0f);
+    }
+
+    testIQIngest("CS8", cs8Inputs, cs8ExpectedOutputs);
+    testIQIngest("CS12", cs12Inputs, cs12ExpectedOutputs);
+    testIQIngest("CS16", cs16Inputs, cs16ExpectedOutputs);
+
+    std::cout << " * Testing DC removal..." << std::endl;
+
+    // With an alpha of 1, a constant input is entirely DC.
+    auto iqIngest = Pothos::BlockRegistry::make("/volk/iq_ingest", "CS16");
+    setAndTestValue(iqIngest, 1.0f, "dcAlpha", "setDCAlpha");
+    setAndTestValue(iqIngest, true, "dcRemoval", "setDCRemoval");
+
+    const auto outputs = VOLKTests::getOneToOneBlockOutputs<std::complex<int16_t>,std::complex<float>>(
+        iqIngest,
+        VOLKTests::stdVectorToBufferChunk(std::vector<std::complex<int16_t>>(numSamples, {1000, -2000})));
+    VOLKTests::testBufferChunks<std::complex<float>>(
+        VOLKTests::stdVectorToBufferChunk(std::vector<std::complex<float>>(numSamples)),
+        outputs);
+
+    std::cout << " * Testing DC removal with IQ swap..." << std::endl;
+
+    // The I and Q offsets differ, so removing either from the other
+    // would leave a residual.
+    auto swappedIQIngest = Pothos::BlockRegistry::make("/volk/iq_ingest", "CS16");
+    setAndTestValue(swappedIQIngest, 1.0f, "dcAlpha", "setDCAlpha");
+    setAndTestValue(swappedIQIngest, true, "dcRemoval", "setDCRemoval");
+    setAndTestValue(swappedIQIngest, true, "iqSwap", "setIQSwap");
+
+    const auto swappedOutputs = VOLKTests::getOneToOneBlockOutputs<std::complex<int16_t>,std::complex<float>>(
+        swappedIQIngest,
+        VOLKTests::stdVectorToBufferChunk(std::vector<std::complex<int16_t>>(numSamples, {1000, -2000})));
+    VOLKTests::testBufferChunks<std::complex<float>>(
+        VOLKTests::stdVectorToBufferChunk(std::vector<std::complex<float>>(numSamples)),
+        swappedOutputs);
+
+    // The offset is reported for the swapped samples.
+    const auto dcOffset = swappedIQIngest.call<std::complex<float>>("dcOffset");
+    POTHOS_TEST_CLOSE(-2000.0f / 32768.0f, dcOffset.real(), 1e-6f);
+    POTHOS_TEST_CLOSE(1000.0f / 32768.0f, dcOffset.imag(), 1e-6f);
+}
+
 //
 // /volk/log2
 //
@@ -795,6 +1887,23 @@ POTHOS_TEST_BLOCK("/volk/tests", test_log2)
         Pothos::BlockRegistry::make("/volk/log2"),
         {1.0f, 2.0f, 4.0f, 5.0f},
         {0.0f, 1.0f, 2.0f, 2.321928f});
+
+    const std::vector<float> decimationInputs = {1.0f, 2.0f, 4.0f, 5.0f, 8.0f, 0.5f, 16.0f};
+    const std::vector<float> decimationOutputs = {0.0f, 1.0f, 2.0f, 2.321928f, 3.0f, -1.0f, 4.0f};
+
+    auto log2 = Pothos::BlockRegistry::make("/volk/log2");
+    for(size_t decimation: {2, 3, 1031})
+    {
+        VOLKTests::testDecimatedOneToOneBlock<float,float>(
+            log2,
+            decimation,
+            decimationInputs,
+            decimationOutputs);
+    }
+
+    POTHOS_TEST_THROWS(
+        log2.call("setDecimation", size_t(0)),
+        Pothos::ProxyExceptionMessage);
 }
 
 //
@@ -810,8 +1919,15 @@ static void testMagnitude(
 
     std::cout << "Testing " << dtype.name() << "..." << std::endl;
 
+    auto magnitude = Pothos::BlockRegistry::make("/volk/magnitude", dtype);
     VOLKTests::testOneToOneBlock<std::complex<T>,T>(
-        Pothos::BlockRegistry::make("/volk/magnitude", dtype),
+        magnitude,
+        inputs,
+        expectedOutputs);
+
+    VOLKTests::testDecimatedOneToOneBlock<std::complex<T>,T>(
+        magnitude,
+        4,
         inputs,
         expectedOutputs);
 }
@@ -881,6 +1997,29 @@ POTHOS_TEST_BLOCK("/volk/tests", test_magnitude_squared)
         expectedOutputs);
 }
 
+//
+// /volk/magnitude_squared_to_half
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_magnitude_squared_to_half)
+{
+    auto block = Pothos::BlockRegistry::make("/volk/magnitude_squared_to_half");
+    POTHOS_TEST_EQUAL("FLOAT16", block.call<std::string>("format"));
+
+    VOLKTests::testOneToOneBlock<std::complex<float>,uint16_t>(
+        block,
+        {{1.0f,0.0f}, {0.0f,-2.0f}, {3.0f,4.0f}, {0.5f,0.5f}, {256.0f,0.0f}},
+        {0x3C00,      0x4400,       0x4E40,      0x3800,      0x7C00});
+
+    block.call("setFormat", "BFLOAT16");
+    POTHOS_TEST_EQUAL("BFLOAT16", block.call<std::string>("format"));
+
+    VOLKTests::testOneToOneBlock<std::complex<float>,uint16_t>(
+        block,
+        {{1.0f,0.0f}, {0.0f,-2.0f}, {3.0f,4.0f}, {0.5f,0.5f}, {256.0f,0.0f}},
+        {0x3F80,      0x4080,       0x41C8,      0x3F00,      0x4780});
+}
+
 //
 // /volk/max
 //
@@ -907,6 +2046,21 @@ POTHOS_TEST_BLOCK("/volk/tests", test_max)
     testMax<double>();
 }
 
+//
+// /volk/max_n
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_max_n)
+{
+    static const auto maxOp = [](double a, double b){return std::max(a, b);};
+
+    for(size_t numInputs: {2, 3, 8})
+    {
+        testNToOneBlock<float>("/volk/max_n", numInputs, maxOp);
+        testNToOneBlock<double>("/volk/max_n", numInputs, maxOp);
+    }
+}
+
 //
 // /volk/max_star
 //
@@ -947,6 +2101,21 @@ POTHOS_TEST_BLOCK("/volk/tests", test_min)
     testMin<double>();
 }
 
+//
+// /volk/min_n
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_min_n)
+{
+    static const auto minOp = [](double a, double b){return std::min(a, b);};
+
+    for(size_t numInputs: {2, 3, 8})
+    {
+        testNToOneBlock<float>("/volk/min_n", numInputs, minOp);
+        testNToOneBlock<double>("/volk/min_n", numInputs, minOp);
+    }
+}
+
 //
 // /volk/mod_range
 //
@@ -994,6 +2163,100 @@ POTHOS_TEST_BLOCK("/volk/tests", test_mod_range)
         expectedOutputs);
 }
 
+//
+// /volk/moving_average
+//
+
+template <typename T>
+static void testMovingAverage(
+    size_t length,
+    size_t decimation)
+{
+    const Pothos::DType dtype(typeid(T));
+
+    std::cout << " * Testing " << dtype.name() << " (length " << length
+              << ", decimation " << decimation << ")..." << std::endl;
+
+    std::vector<T> inputs;
+    for(size_t i = 0; i < 1000; ++i) inputs.emplace_back(T(float(i % 17) - 8.0f));
+
+    // The block's window starts filled with zeros.
+    std::vector<T> expectedOutputs;
+    for(size_t i = 0; i < inputs.size(); i += decimation)
+    {
+        T sum(0);
+        for(size_t j = ((i+1) >= length) ? (i+1-length) : 0; j <= i; ++j) sum += inputs[j];
+
+        expectedOutputs.emplace_back(sum / T(float(length)));
+    }
+
+    auto movingAverage = Pothos::BlockRegistry::make(
+        "/volk/moving_average",
+        dtype,
+        decimation);
+    setAndTestValue(movingAverage, length, "length", "setLength");
+    POTHOS_TEST_EQUAL("AVERAGE", movingAverage.call<std::string>("mode"));
+
+    const auto outputs = VOLKTests::getOneToOneBlockOutputs<T,T>(
+        movingAverage,
+        VOLKTests::stdVectorToBufferChunk(inputs));
+    VOLKTests::testBufferChunks<T>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        outputs);
+}
+
+// Long enough for several periodic resums, which bound the running
+// sum's drift. Without them, this drifts well past the tolerance.
+static void testMovingAverageDrift()
+{
+    constexpr size_t Length = 16;
+    constexpr size_t NumInputs = 8 * 8192;
+
+    std::cout << " * Testing drift over " << NumInputs << " inputs..." << std::endl;
+
+    std::vector<float> inputs;
+    for(size_t i = 0; i < NumInputs; ++i)
+    {
+        inputs.emplace_back((float(i % 17) * 0.1f) + 100.0f + (float(i % 5) * 0.013f));
+    }
+
+    // The reference is summed in double precision.
+    std::vector<float> expectedOutputs;
+    for(size_t i = 0; i < inputs.size(); ++i)
+    {
+        double sum = 0.0;
+        for(size_t j = ((i+1) >= Length) ? (i+1-Length) : 0; j <= i; ++j) sum += inputs[j];
+
+        expectedOutputs.emplace_back(float(sum / double(Length)));
+    }
+
+    auto movingAverage = Pothos::BlockRegistry::make(
+        "/volk/moving_average",
+        "float32",
+        1);
+    movingAverage.call("setLength", Length);
+
+    const auto outputs = VOLKTests::getOneToOneBlockOutputs<float,float>(
+        movingAverage,
+        VOLKTests::stdVectorToBufferChunk(inputs));
+    VOLKTests::testBufferChunksClose<float>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        outputs,
+        0.02f);
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_moving_average)
+{
+    for(size_t decimation: {1, 3, 32})
+    {
+        testMovingAverage<float>(16, decimation);
+        testMovingAverage<double>(16, decimation);
+        testMovingAverage<std::complex<float>>(16, decimation);
+    }
+
+    testMovingAverageDrift();
+}
+
 //
 // /volk/multiply
 //
@@ -1051,6 +2314,31 @@ POTHOS_TEST_BLOCK("/volk/tests", test_multiply)
         {{-2.5f,-2.0f}, {-1.5f,-1.0f},  {-0.5f,0.5f}, {1.0f,1.5f},  {2.0f,2.5f}},
         {1.0f,          1.5f,           2.0f,         2.5f,         3.5f},
         {{-2.5f,-2.0f}, {-2.25f,-1.5f}, {-1.0f,1.0f}, {2.5f,3.75f}, {7.0f,8.75f}});
+
+    const Pothos::DType cfloatDType(typeid(std::complex<float>));
+
+    for(size_t broadcastSize: {1, 7, 4099})
+    {
+        VOLKTests::testBroadcastTwoToOneBlock<std::complex<float>>(
+            Pothos::BlockRegistry::make("/volk/multiply", cfloatDType, cfloatDType, cfloatDType),
+            broadcastSize,
+            std::multiplies<std::complex<float>>());
+    }
+}
+
+//
+// /volk/multiply_n
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_multiply_n)
+{
+    for(size_t numInputs: {2, 3, 8})
+    {
+        testNToOneBlock<float>("/volk/multiply_n", numInputs, std::multiplies<float>());
+        testNToOneBlock<double>("/volk/multiply_n", numInputs, std::multiplies<double>());
+        testNToOneBlock<std::complex<int16_t>>("/volk/multiply_n", numInputs, std::multiplies<std::complex<int16_t>>());
+        testNToOneBlock<std::complex<float>>("/volk/multiply_n", numInputs, std::multiplies<std::complex<float>>());
+    }
 }
 
 //
@@ -1132,6 +2420,22 @@ POTHOS_TEST_BLOCK("/volk/tests", test_multiply_conjugate_add)
         1);
 }
 
+//
+// /volk/multiply_conjugate_cint16
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_multiply_conjugate_cint16)
+{
+    // Q15, so 16384 is 0.5
+    VOLKTests::testTwoToOneBlock<std::complex<int16_t>,std::complex<int16_t>,std::complex<int16_t>,size_t>(
+        Pothos::BlockRegistry::make("/volk/multiply_conjugate_cint16"),
+        {{16384,0}, {16384,16384}, {-32768,-32768}, {10000,-20000}, {-12345,23456}},
+        {{16384,0}, {0,16384},     {-32768,-32768}, {3000,4000},    {-30000,-7}},
+        {{8192,0},  {8192,-8192},  {32767,0},       {-1526,-3052},  {11297,-21477}},
+        0,
+        1);
+}
+
 //
 // /volk/multiply_conjugate_scaled
 //
@@ -1204,6 +2508,123 @@ static void testMultiplyScalar(
         expectedOutputs);
 }
 
+// The scalar should change at each label's exact sample, and the labels
+// shouldn't be forwarded.
+static void testMultiplyScalarLabels()
+{
+    std::cout << "Testing setter labels..." << std::endl;
+
+    const std::vector<std::pair<size_t, float>> scalarLabels =
+    {
+        {0, 2.0f}, {1, -1.0f}, {317, 0.5f}, {318, 4.0f}, {999, -3.0f}
+    };
+
+    std::vector<float> inputs;
+    for(size_t i = 0; i < 1000; ++i) inputs.emplace_back(float(i % 7) - 3.0f);
+
+    std::vector<float> expectedOutputs;
+    auto labelIter = scalarLabels.begin();
+    float scalar = 1.0f;
+    for(size_t i = 0; i < inputs.size(); ++i)
+    {
+        if((labelIter != scalarLabels.end()) && (labelIter->first == i))
+        {
+            scalar = (labelIter++)->second;
+        }
+        expectedOutputs.emplace_back(inputs[i] * scalar);
+    }
+
+    const Pothos::DType dtype(typeid(float));
+
+    auto multiplyScalarBlock = Pothos::BlockRegistry::make(
+        "/volk/multiply_scalar",
+        dtype);
+    setAndTestValue(multiplyScalarBlock, 1.0f);
+
+    auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+    for(const auto& scalarLabel: scalarLabels)
+    {
+        source.call(
+            "feedLabel",
+            Pothos::Label("setScalar", scalarLabel.second, scalarLabel.first));
+    }
+    source.call("feedBuffer", VOLKTests::stdVectorToBufferChunk(inputs));
+
+    auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+
+    {
+        Pothos::Topology topology;
+        topology.connect(source, 0, multiplyScalarBlock, 0);
+        topology.connect(multiplyScalarBlock, 0, sink, 0);
+
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+    }
+
+    VOLKTests::testBufferChunks<float>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        sink.call<Pothos::BufferChunk>("getBuffer"));
+    POTHOS_TEST_EQUAL(scalarLabels.back().second, multiplyScalarBlock.call<float>("scalar"));
+
+    for(const auto& label: sink.call<std::vector<Pothos::Label>>("getLabels"))
+    {
+        POTHOS_TEST_TRUE(label.id != "setScalar");
+    }
+}
+
+// Packets should be processed directly, keeping their metadata and labels.
+static void testMultiplyScalarPackets()
+{
+    std::cout << "Testing packets..." << std::endl;
+
+    const Pothos::DType dtype(typeid(float));
+    constexpr float scalar = 0.5f;
+
+    std::vector<float> inputs;
+    for(size_t i = 0; i < 100; ++i) inputs.emplace_back(float(i) - 50.0f);
+
+    std::vector<float> expectedOutputs;
+    for(const auto& input: inputs) expectedOutputs.emplace_back(input * scalar);
+
+    Pothos::Packet packet;
+    packet.payload = VOLKTests::stdVectorToBufferChunk(inputs);
+    packet.metadata["frameNum"] = Pothos::Object(size_t(7));
+    packet.labels.emplace_back("burst", true, 42);
+
+    auto multiplyScalarBlock = Pothos::BlockRegistry::make(
+        "/volk/multiply_scalar",
+        dtype);
+    setAndTestValue(multiplyScalarBlock, scalar);
+
+    auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+    source.call("feedPacket", packet);
+
+    auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+
+    {
+        Pothos::Topology topology;
+        topology.connect(source, 0, multiplyScalarBlock, 0);
+        topology.connect(multiplyScalarBlock, 0, sink, 0);
+
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+    }
+
+    POTHOS_TEST_EQUAL(size_t(0), sink.call<Pothos::BufferChunk>("getBuffer").elements());
+
+    const auto messages = sink.call<std::vector<Pothos::Object>>("getMessages");
+    POTHOS_TEST_EQUAL(size_t(1), messages.size());
+
+    const auto& outputPacket = messages[0].extract<Pothos::Packet>();
+    VOLKTests::testBufferChunks<float>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        outputPacket.payload);
+    POTHOS_TEST_EQUAL(size_t(7), outputPacket.metadata.at("frameNum").convert<size_t>());
+    POTHOS_TEST_EQUAL(size_t(1), outputPacket.labels.size());
+    POTHOS_TEST_EQUAL("burst", outputPacket.labels[0].id);
+    POTHOS_TEST_EQUAL(size_t(42), outputPacket.labels[0].index);
+}
+
 POTHOS_TEST_BLOCK("/volk/tests", test_multiply_scalar)
 {
     testMultiplyScalar<float>(
@@ -1213,6 +2634,63 @@ POTHOS_TEST_BLOCK("/volk/tests", test_multiply_scalar)
     testMultiplyScalar<std::complex<float>>(
         {{0.1f,0.2f}, {0.3f,0.4f}, {0.5f,0.6f}, {0.7f,0.8f}, {0.9f,1.0f}},
         {0.123f, 0.456f});
+    testMultiplyScalarLabels();
+    testMultiplyScalarPackets();
+}
+
+//
+// /volk/multiply_scalar_cint16
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_multiply_scalar_cint16)
+{
+    auto block = Pothos::BlockRegistry::make("/volk/multiply_scalar_cint16");
+    setAndTestValue(block, std::complex<float>(0.5f, -0.25f));
+
+    // Q15, so the scalar is (16384,-8192)
+    VOLKTests::testOneToOneBlock<std::complex<int16_t>,std::complex<int16_t>>(
+        block,
+        {{16384,0},    {0,16384},   {-32768,-32768}, {10000,-20000}, {32767,32767}},
+        {{8192,-4096}, {4096,8192}, {-24576,-8192},  {0,-12500},     {24575,8192}});
+}
+
+//
+// /volk/multiply_scalar_to_half
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_multiply_scalar_to_half)
+{
+    auto floatBlock = Pothos::BlockRegistry::make(
+        "/volk/multiply_scalar_to_half",
+        "float32");
+    setAndTestValue(floatBlock, 0.5f);
+
+    VOLKTests::testOneToOneBlock<float,uint16_t>(
+        floatBlock,
+        {2.0f,   -1.0f,  8.0f,   0.0f},
+        {0x3C00, 0xB800, 0x4400, 0x0000});
+
+    floatBlock.call("setFormat", "BFLOAT16");
+
+    VOLKTests::testOneToOneBlock<float,uint16_t>(
+        floatBlock,
+        {2.0f,   -1.0f,  8.0f,   0.0f},
+        {0x3F80, 0xBF00, 0x4080, 0x0000});
+
+    auto complexBlock = Pothos::BlockRegistry::make(
+        "/volk/multiply_scalar_to_half",
+        "complex_float32");
+    setAndTestValue(complexBlock, std::complex<float>(0.0f, 1.0f));
+
+    // Multiplying by j swaps the parts and negates the new real part.
+    VOLKTests::testOneToOneBlock<std::complex<float>,std::complex<uint16_t>>(
+        complexBlock,
+        {{1.0f,2.0f},     {-0.5f,4.0f}},
+        {{0xC000,0x3C00}, {0xC400,0xB800}});
+
+    POTHOS_TEST_THROWS(
+        complexBlock.call("setFormat", "FLOAT32"),
+        Pothos::ProxyExceptionMessage);
 }
 
 //
@@ -1253,6 +2731,106 @@ POTHOS_TEST_BLOCK("/volk/tests", test_or)
         1);
 }
 
+//
+// /volk/pack_bits
+//
+
+// An odd number of bytes, so vectorized packing needs a remainder
+static constexpr size_t NumPackedBytes = 37;
+
+static std::vector<int8_t> getTestBits()
+{
+    std::vector<int8_t> bits;
+    for(size_t i = 0; i < (NumPackedBytes * 8); ++i)
+    {
+        bits.emplace_back(int8_t(((i * 7) + (i / 5)) % 3 == 0));
+    }
+
+    return bits;
+}
+
+static std::vector<uint8_t> getPackedBytes(
+    const std::vector<int8_t>& bits,
+    bool msbFirst)
+{
+    std::vector<uint8_t> bytes(bits.size() / 8, 0);
+    for(size_t i = 0; i < bits.size(); ++i)
+    {
+        const auto shift = msbFirst ? (7 - (i % 8)) : (i % 8);
+        bytes[i / 8] |= uint8_t(bits[i] << shift);
+    }
+
+    return bytes;
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_pack_bits)
+{
+    const auto bits = getTestBits();
+
+    // Soft symbols, including zero, which the binary slicer treats as a one
+    std::vector<float> softSymbols;
+    for(size_t i = 0; i < bits.size(); ++i)
+    {
+        const float magnitude = float((i % 4) * 0.5);
+        softSymbols.emplace_back(bits[i] ? magnitude : -(magnitude + 0.25f));
+    }
+
+    for(const std::string& bitOrder: {"MSB", "LSB"})
+    {
+        std::cout << " * Testing " << bitOrder << " first..." << std::endl;
+
+        const auto expectedOutputs = VOLKTests::stdVectorToBufferChunk(
+            getPackedBytes(bits, (bitOrder == "MSB")));
+
+        auto packInt8 = Pothos::BlockRegistry::make(
+            "/volk/pack_bits",
+            Pothos::DType(typeid(int8_t)));
+        packInt8.call("setBitOrder", bitOrder);
+        POTHOS_TEST_EQUAL(bitOrder, packInt8.call<std::string>("bitOrder"));
+
+        VOLKTests::testBufferChunks<uint8_t>(
+            expectedOutputs,
+            VOLKTests::getOneToOneBlockOutputs<int8_t,uint8_t>(
+                packInt8,
+                VOLKTests::stdVectorToBufferChunk(bits)));
+
+        auto packFloat = Pothos::BlockRegistry::make(
+            "/volk/pack_bits",
+            Pothos::DType(typeid(float)));
+        packFloat.call("setBitOrder", bitOrder);
+
+        VOLKTests::testBufferChunks<uint8_t>(
+            expectedOutputs,
+            VOLKTests::getOneToOneBlockOutputs<float,uint8_t>(
+                packFloat,
+                VOLKTests::stdVectorToBufferChunk(softSymbols)));
+    }
+}
+
+//
+// /volk/polynomial
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_polynomial)
+{
+    const std::vector<float> coefficients{1.0f, -2.0f, 0.5f};
+
+    auto polynomialBlock = Pothos::BlockRegistry::make("/volk/polynomial");
+    polynomialBlock.call("setCoefficients", coefficients);
+    POTHOS_TEST_EQUALV(
+        coefficients,
+        polynomialBlock.call<std::vector<float>>("coefficients"));
+
+    const std::vector<float> inputs{-2.0f, -1.0f, 0.0f, 0.5f, 1.0f, 2.0f, 3.0f};
+    std::vector<float> expectedOutputs;
+    for(float x: inputs) expectedOutputs.emplace_back(1.0f - (2.0f*x) + (0.5f*x*x));
+
+    VOLKTests::testOneToOneBlock<float,float>(
+        polynomialBlock,
+        inputs,
+        expectedOutputs);
+}
+
 //
 // /volk/popcnt
 //
@@ -1306,6 +2884,124 @@ POTHOS_TEST_BLOCK("/volk/tests", test_power)
 // /volk/power_spectral_density
 //
 
+// Feed frames whose points all have a magnitude of (frame % numFrames) + 1
+// and make sure the block only outputs one frame per numFrames frames.
+static void testPowerSpectrumAveraging(
+    const Pothos::Proxy& block,
+    const std::string& averagingMode,
+    float dBOffset)
+{
+    std::cout << " * Testing " << averagingMode << " averaging..." << std::endl;
+
+    constexpr size_t FFTSize = 64;
+    constexpr size_t NumFrames = 4;
+    constexpr size_t NumOutputFrames = 8;
+
+    block.call("setFFTSize", FFTSize);
+    block.call("setNumFrames", NumFrames);
+    block.call("setAveragingMode", averagingMode);
+    block.call("setAlpha", 0.5f);
+    POTHOS_TEST_EQUAL(averagingMode, block.call<std::string>("averagingMode"));
+
+    std::vector<std::complex<float>> inputs;
+    for(size_t frame = 0; frame < (NumFrames * NumOutputFrames); ++frame)
+    {
+        const std::complex<float> value(float((frame % NumFrames) + 1), 0.0f);
+        inputs.insert(inputs.end(), FFTSize, value);
+    }
+
+    // Powers are 1, 4, 9, 16
+    std::vector<float> expectedPowers(NumOutputFrames, 0.0f);
+    if(averagingMode == "LINEAR")        expectedPowers.assign(NumOutputFrames, 7.5f);
+    else if(averagingMode == "MAX_HOLD") expectedPowers.assign(NumOutputFrames, 16.0f);
+    else if(averagingMode == "MIN_HOLD") expectedPowers.assign(NumOutputFrames, 1.0f);
+    else if(averagingMode == "EXPONENTIAL")
+    {
+        // With an alpha of 0.5, the first output is
+        // (((1+4)/2 + 9)/2 + 16)/2 = 10.875. The average carries over,
+        // so each later output is 1/16 of the previous one plus
+        // 16/2 + 9/4 + 4/8 + 1/16 = 10.8125. The second is 11.4921875,
+        // and the rest are within 0.001 dB of the limit, 173/15.
+        expectedPowers.assign(NumOutputFrames, 173.0f / 15.0f);
+        expectedPowers[0] = 10.875f;
+        expectedPowers[1] = 11.4921875f;
+    }
+
+    const auto outputs = VOLKTests::getOneToOneBlockOutputs<std::complex<float>,float>(
+        block,
+        VOLKTests::stdVectorToBufferChunk(inputs));
+    POTHOS_TEST_EQUAL(FFTSize * NumOutputFrames, outputs.elements());
+
+    const auto* outputPtr = outputs.as<const float*>();
+    for(size_t i = 0; i < outputs.elements(); ++i)
+    {
+        const float expectedDB = (10.0f * std::log10(expectedPowers[i / FFTSize])) + dBOffset;
+        POTHOS_TEST_CLOSE(expectedDB, outputPtr[i], 1e-2f);
+    }
+
+    block.call("setAveragingMode", std::string("NONE"));
+}
+
+// When averaging, a scaling label should only affect the frames from its
+// own onward, not the ones already accumulated. The label's value must
+// make the linear power 4x smaller than a value of 1.
+static void testPowerSpectrumScalingLabel(
+    const Pothos::Proxy& block,
+    const std::string& setter,
+    const std::string& getter,
+    float labelValue)
+{
+    std::cout << " * Testing " << setter << " labels..." << std::endl;
+
+    constexpr size_t FFTSize = 64;
+    constexpr size_t NumFrames = 2;
+
+    block.call("setNormalizationFactor", 1.0f);
+    block.call(setter, 1.0f);
+    block.call("setFFTSize", FFTSize);
+    block.call("setNumFrames", NumFrames);
+    block.call("setAveragingMode", std::string("LINEAR"));
+
+    const Pothos::DType dtype("complex_float32");
+
+    auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+    source.call(
+        "feedLabel",
+        Pothos::Label(setter, labelValue, FFTSize));
+    source.call(
+        "feedBuffer",
+        VOLKTests::stdVectorToBufferChunk(std::vector<std::complex<float>>(FFTSize * NumFrames * 2, {1.0f, 0.0f})));
+
+    auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", "float32");
+
+    {
+        Pothos::Topology topology;
+        topology.connect(source, 0, block, 0);
+        topology.connect(block, 0, sink, 0);
+
+        topology.commit();
+        POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+    }
+
+    // The first output averages powers of 1 and 0.25, and the second
+    // only has powers of 0.25.
+    std::vector<float> expectedOutputs(FFTSize, 10.0f * std::log10(0.625f));
+    expectedOutputs.insert(expectedOutputs.end(), FFTSize, 10.0f * std::log10(0.25f));
+
+    VOLKTests::testBufferChunksClose<float>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        sink.call<Pothos::BufferChunk>("getBuffer"),
+        1e-2f);
+    POTHOS_TEST_EQUAL(labelValue, block.call<float>(getter));
+
+    for(const auto& label: sink.call<std::vector<Pothos::Label>>("getLabels"))
+    {
+        POTHOS_TEST_TRUE(label.id != setter);
+    }
+
+    block.call("setAveragingMode", std::string("NONE"));
+}
+
 POTHOS_TEST_BLOCK("/volk/tests", test_power_spectral_density)
 {
     const float normalizationFactor = 10.0f;
@@ -1326,6 +3022,35 @@ POTHOS_TEST_BLOCK("/volk/tests", test_power_spectral_density)
         {},
         false /*lax*/,
         false /*testOutputs*/);
+
+    // Normalization of 2 makes the linear power 4x smaller.
+    setAndTestValue(
+        powerSpectralDensityBlock,
+        2.0f,
+        "normalizationFactor",
+        "setNormalizationFactor");
+    const float dBOffset = (-10.0f * std::log10(4.0f)) - (10.0f * std::log10(rbw));
+
+    for(const std::string& averagingMode: {"LINEAR", "EXPONENTIAL", "MAX_HOLD", "MIN_HOLD"})
+    {
+        testPowerSpectrumAveraging(
+            powerSpectralDensityBlock,
+            averagingMode,
+            dBOffset);
+    }
+
+    // Normalization of 2 and an RBW of 4 each make the linear power 4x
+    // smaller.
+    testPowerSpectrumScalingLabel(
+        powerSpectralDensityBlock,
+        "setNormalizationFactor",
+        "normalizationFactor",
+        2.0f);
+    testPowerSpectrumScalingLabel(
+        powerSpectralDensityBlock,
+        "setRBW",
+        "rbw",
+        4.0f);
 }
 
 //
@@ -1350,6 +3075,26 @@ POTHOS_TEST_BLOCK("/volk/tests", test_power_spectrum)
         {},
         false /*lax*/,
         false /*testOutputs*/);
+
+    setAndTestValue(
+        powerSpectrumBlock,
+        1.0f,
+        "normalizationFactor",
+        "setNormalizationFactor");
+
+    for(const std::string& averagingMode: {"LINEAR", "EXPONENTIAL", "MAX_HOLD", "MIN_HOLD"})
+    {
+        testPowerSpectrumAveraging(
+            powerSpectrumBlock,
+            averagingMode,
+            0.0f);
+    }
+
+    testPowerSpectrumScalingLabel(
+        powerSpectrumBlock,
+        "setNormalizationFactor",
+        "normalizationFactor",
+        2.0f);
 }
 
 //
@@ -1489,6 +3234,66 @@ POTHOS_TEST_BLOCK("/volk/tests", test_subtract)
         1);
 }
 
+//
+// /volk/subtract_cint16
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_subtract_cint16)
+{
+    VOLKTests::testTwoToOneBlock<std::complex<int16_t>,std::complex<int16_t>,std::complex<int16_t>,size_t>(
+        Pothos::BlockRegistry::make("/volk/subtract_cint16"),
+        {{1000,-2000}, {-32000,32000}, {32767,-32768}, {-5,7},   {100,200}},
+        {{500,500},    {1000,-1000},   {1,-1},         {5,-7},   {-300,50}},
+        {{500,-2500},  {-32768,32767}, {32766,-32767}, {-10,14}, {400,150}},
+        0,
+        1);
+}
+
+//
+// /volk/sum_of_poly
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_sum_of_poly)
+{
+    constexpr size_t frameSize = 8;
+    constexpr float cutoff = -1.0f;
+    const std::vector<float> coefficients{0.5f, 1.0f, -0.25f, 0.125f, 2.0f};
+
+    auto sumOfPolyBlock = Pothos::BlockRegistry::make("/volk/sum_of_poly");
+    setAndTestValue(sumOfPolyBlock, frameSize, "frameSize", "setFrameSize");
+    setAndTestValue(sumOfPolyBlock, cutoff, "cutoff", "setCutoff");
+    sumOfPolyBlock.call("setCoefficients", coefficients);
+    POTHOS_TEST_EQUALV(
+        coefficients,
+        sumOfPolyBlock.call<std::vector<float>>("coefficients"));
+
+    std::vector<float> inputs;
+    for(size_t i = 0; i < (frameSize * 32); ++i) inputs.emplace_back((float(i % 13) * 0.25f) - 2.0f);
+
+    std::vector<float> expectedOutputs;
+    for(size_t frame = 0; frame < (inputs.size() / frameSize); ++frame)
+    {
+        float sum = 0.0f;
+        for(size_t i = 0; i < frameSize; ++i)
+        {
+            const float x = std::max(inputs[(frame * frameSize) + i], cutoff);
+            sum += (coefficients[0] * x)
+                 + (coefficients[1] * x * x)
+                 + (coefficients[2] * x * x * x)
+                 + (coefficients[3] * x * x * x * x)
+                 + coefficients[4];
+        }
+        expectedOutputs.emplace_back(sum);
+    }
+
+    const auto outputs = VOLKTests::getOneToOneBlockOutputs<float,float>(
+        sumOfPolyBlock,
+        VOLKTests::stdVectorToBufferChunk(inputs));
+    VOLKTests::testBufferChunks<float>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        outputs);
+}
+
 //
 // /volk/tan
 //
@@ -1512,3 +3317,175 @@ POTHOS_TEST_BLOCK("/volk/tests", test_tanh)
         {0.0f, float(M_PI_2),   float(M_PI)},
         {0.0f, 0.91715f, 0.99627f});
 }
+
+//
+// /volk/to_db
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_to_db)
+{
+    const Pothos::DType floatDType(typeid(float));
+    const Pothos::DType complexDType(typeid(std::complex<float>));
+
+    const std::vector<float> powerInputs{1.0f, 10.0f, 100.0f, 0.1f, 0.5f, 2e-6f};
+    const std::vector<float> powerOutputs{0.0f, 10.0f, 20.0f, -10.0f, -3.0103f, -56.9897f};
+
+    for(const std::string& precision: {"PRECISE", "FAST"})
+    {
+        std::cout << " * Testing " << precision << "..." << std::endl;
+
+        auto powerToDB = Pothos::BlockRegistry::make("/volk/to_db", floatDType);
+        powerToDB.call("setMode", "POWER");
+        powerToDB.call("setPrecision", precision);
+        POTHOS_TEST_EQUAL("POWER", powerToDB.call<std::string>("mode"));
+        POTHOS_TEST_EQUAL(precision, powerToDB.call<std::string>("precision"));
+
+        VOLKTests::testOneToOneBlock<float,float>(
+            powerToDB,
+            powerInputs,
+            powerOutputs);
+
+        auto amplitudeToDB = Pothos::BlockRegistry::make("/volk/to_db", floatDType);
+        amplitudeToDB.call("setPrecision", precision);
+        POTHOS_TEST_EQUAL("AMPLITUDE", amplitudeToDB.call<std::string>("mode"));
+
+        VOLKTests::testOneToOneBlock<float,float>(
+            amplitudeToDB,
+            {1.0f, -10.0f, 0.1f, 0.5f},
+            {0.0f, 20.0f,  -20.0f, -6.0206f});
+
+        auto complexToDB = Pothos::BlockRegistry::make("/volk/to_db", complexDType);
+        complexToDB.call("setPrecision", precision);
+
+        VOLKTests::testOneToOneBlock<std::complex<float>,float>(
+            complexToDB,
+            {{1.0f,0.0f}, {0.0f,-10.0f}, {3.0f,4.0f}, {0.06f,0.08f}},
+            {0.0f,        20.0f,         13.9794f,    -20.0f});
+    }
+
+    std::cout << " * Testing floor..." << std::endl;
+
+    auto floorToDB = Pothos::BlockRegistry::make("/volk/to_db", floatDType);
+    floorToDB.call("setMode", "POWER");
+    floorToDB.call("setFloorEnabled", true);
+    setAndTestValue(floorToDB, -50.0f, "floor", "setFloor");
+
+    VOLKTests::testOneToOneBlock<float,float>(
+        floorToDB,
+        {0.0f,   1e-9f,  1e-5f,  100.0f},
+        {-50.0f, -50.0f, -50.0f, 20.0f});
+}
+
+// As with the fallback kernels, every supported table is tested against
+// the generic one. The approximate log2 may use fused multiply-adds, and
+// should stay within its documented error of the true value.
+POTHOS_TEST_BLOCK("/volk/tests", test_to_db_kernels)
+{
+    const auto tables = ToDBKernels::getSupportedKernelTables();
+    POTHOS_TEST_EQUAL("generic", tables.front().first);
+
+    std::vector<float> inputs;
+    for(unsigned int i = 0; i < NumFallbackPoints; ++i)
+    {
+        inputs.emplace_back(std::pow(10.0f, std::sin(float(i) * 0.1f) * 10.0f));
+    }
+
+    std::vector<float> expectedOutputs(NumFallbackPoints);
+    tables.front().second.fastLog2(expectedOutputs.data(), inputs.data(), NumFallbackPoints);
+
+    for(const auto& table: tables)
+    {
+        std::cout << " * Testing " << table.first << std::endl;
+
+        std::vector<float> actualOutputs(NumFallbackPoints);
+        table.second.fastLog2(actualOutputs.data(), inputs.data(), NumFallbackPoints);
+        POTHOS_TEST_CLOSEA(expectedOutputs.data(), actualOutputs.data(), 1e-5f, NumFallbackPoints);
+        for(unsigned int i = 0; i < NumFallbackPoints; ++i)
+        {
+            POTHOS_TEST_CLOSE(std::log2(inputs[i]), actualOutputs[i], 4e-4f);
+        }
+    }
+}
+
+//
+// /volk/unpack_bits
+//
+
+POTHOS_TEST_BLOCK("/volk/tests", test_unpack_bits)
+{
+    const auto bits = getTestBits();
+
+    for(const std::string& bitOrder: {"MSB", "LSB"})
+    {
+        std::cout << " * Testing " << bitOrder << " first..." << std::endl;
+
+        auto unpackBits = Pothos::BlockRegistry::make("/volk/unpack_bits");
+        unpackBits.call("setBitOrder", bitOrder);
+        POTHOS_TEST_EQUAL(bitOrder, unpackBits.call<std::string>("bitOrder"));
+
+        VOLKTests::testBufferChunks<int8_t>(
+            VOLKTests::stdVectorToBufferChunk(bits),
+            VOLKTests::getOneToOneBlockOutputs<uint8_t,int8_t>(
+                unpackBits,
+                VOLKTests::stdVectorToBufferChunk(getPackedBytes(bits, (bitOrder == "MSB")))));
+    }
+}
+
+//
+// /volk/window
+//
+
+template <typename T>
+static void testWindow()
+{
+    const Pothos::DType dtype(typeid(T));
+
+    std::cout << " * Testing " << dtype.name() << "..." << std::endl;
+
+    auto window = Pothos::BlockRegistry::make("/volk/window", dtype);
+
+    // Check the symmetry and endpoints of each generated window.
+    setAndTestValue(window, size_t(9), "windowSize", "setWindowSize");
+    for(const std::string windowType: {"HANN", "BLACKMAN", "KAISER"})
+    {
+        window.call("setWindowType", windowType);
+        POTHOS_TEST_EQUAL(windowType, window.call<std::string>("windowType"));
+
+        const auto coeffs = window.call<std::vector<float>>("coefficients");
+        POTHOS_TEST_EQUAL(size_t(9), coeffs.size());
+        POTHOS_TEST_CLOSE(1.0f, coeffs[4], 1e-3f);
+        for(size_t i = 0; i < coeffs.size(); ++i)
+        {
+            POTHOS_TEST_CLOSE(coeffs[i], coeffs[coeffs.size()-1-i], 1e-6f);
+        }
+    }
+    POTHOS_TEST_CLOSE(0.0f, window.call<std::vector<float>>("coefficients")[0], 0.1f);
+
+    // Use a window size that doesn't evenly divide the number of inputs
+    // so the window's phase is carried across calls.
+    const std::vector<float> coeffs{0.5f, 1.0f, 2.0f, 0.0f, -1.0f, 0.25f, 3.0f};
+    window.call("setCoefficients", coeffs);
+    POTHOS_TEST_EQUAL("CUSTOM", window.call<std::string>("windowType"));
+    POTHOS_TEST_EQUAL(coeffs.size(), window.call<size_t>("windowSize"));
+
+    std::vector<T> inputs;
+    std::vector<T> expectedOutputs;
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        inputs.emplace_back(T(float(i % 13) - 6.0f));
+        expectedOutputs.emplace_back(inputs.back() * coeffs[i % coeffs.size()]);
+    }
+
+    const auto outputs = VOLKTests::getOneToOneBlockOutputs<T,T>(
+        window,
+        VOLKTests::stdVectorToBufferChunk(inputs));
+    VOLKTests::testBufferChunks<T>(
+        VOLKTests::stdVectorToBufferChunk(expectedOutputs),
+        outputs);
+}
+
+POTHOS_TEST_BLOCK("/volk/tests", test_window)
+{
+    testWindow<float>();
+    testWindow<std::complex<float>>();
+}
@@ -79,6 +79,36 @@ namespace VOLKTests
             lax);
     }
 
+    // For blocks whose output count doesn't match their input count,
+    // so the caller must check the outputs itself.
+    template <typename InType, typename OutType>
+    Pothos::BufferChunk getOneToOneBlockOutputs(
+        const Pothos::Proxy& testBlock,
+        const Pothos::BufferChunk& testInputs)
+    {
+        static const Pothos::DType InDType(typeid(InType));
+        static const Pothos::DType OutDType(typeid(OutType));
+
+        auto source = Pothos::BlockRegistry::make("/blocks/feeder_source", InDType);
+        source.call("feedBuffer", testInputs);
+
+        auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", OutDType);
+
+        {
+            Pothos::Topology topology;
+            topology.connect(source, 0, testBlock, 0);
+            topology.connect(testBlock, 0, sink, 0);
+
+            topology.commit();
+            POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+        }
+
+        auto outputs = sink.call<Pothos::BufferChunk>("getBuffer");
+        POTHOS_TEST_EQUAL(OutDType, outputs.dtype);
+
+        return outputs;
+    }
+
     template <typename InType, typename OutType>
     void testOneToOneBlock(
         const Pothos::Proxy& testBlock,
@@ -128,6 +158,45 @@ namespace VOLKTests
         }
     }
 
+    // Only every decimation-th output is expected, starting with the
+    // first, so the phase carries across the stretched inputs.
+    template <typename T>
+    std::vector<T> decimateStdVector(
+        const std::vector<T>& inputs,
+        size_t decimation)
+    {
+        std::vector<T> outputs;
+        for(size_t i = 0; i < inputs.size(); i += decimation) outputs.emplace_back(inputs[i]);
+
+        return outputs;
+    }
+
+    template <typename InType, typename OutType>
+    void testDecimatedOneToOneBlock(
+        const Pothos::Proxy& testBlock,
+        size_t decimation,
+        const std::vector<InType>& testInputsVec,
+        const std::vector<OutType>& expectedOutputsVec,
+        bool lax = false)
+    {
+        std::cout << " * Testing decimation " << decimation << "..." << std::endl;
+
+        testBlock.call("setDecimation", decimation);
+        POTHOS_TEST_EQUAL(decimation, testBlock.call<size_t>("decimation"));
+
+        const auto expectedOutputs = decimateStdVector(
+            stretchStdVector(expectedOutputsVec, NumRepetitions),
+            decimation);
+
+        auto outputs = getOneToOneBlockOutputs<InType, OutType>(
+            testBlock,
+            stdVectorToStretchedBufferChunk(testInputsVec, NumRepetitions));
+        testBufferChunks<OutType>(
+            stdVectorToBufferChunk(expectedOutputs),
+            outputs,
+            lax);
+    }
+
     template <typename InType, typename OutType0, typename OutType1, typename OutputPortType>
     void testOneToTwoBlock(
         const Pothos::Proxy& testBlock,
@@ -231,6 +300,101 @@ namespace VOLKTests
             lax);
     }
 
+    template <typename T>
+    void testDecimatedTwoToOneBlock(
+        const Pothos::Proxy& testBlock,
+        size_t decimation,
+        const std::vector<T>& testInputs0Vec,
+        const std::vector<T>& testInputs1Vec,
+        const std::vector<T>& expectedOutputsVec)
+    {
+        static const Pothos::DType dtype(typeid(T));
+
+        std::cout << " * Testing decimation " << decimation << "..." << std::endl;
+
+        testBlock.call("setDecimation", decimation);
+        POTHOS_TEST_EQUAL(decimation, testBlock.call<size_t>("decimation"));
+
+        const auto expectedOutputs = decimateStdVector(
+            stretchStdVector(expectedOutputsVec, NumRepetitions),
+            decimation);
+
+        auto source0 = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+        source0.call("feedBuffer", stdVectorToStretchedBufferChunk(testInputs0Vec, NumRepetitions));
+
+        auto source1 = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+        source1.call("feedBuffer", stdVectorToStretchedBufferChunk(testInputs1Vec, NumRepetitions));
+
+        auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+
+        {
+            Pothos::Topology topology;
+            topology.connect(source0, 0, testBlock, 0);
+            topology.connect(source1, 0, testBlock, 1);
+            topology.connect(testBlock, 0, sink, 0);
+
+            topology.commit();
+            POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+        }
+
+        testBufferChunks<T>(
+            stdVectorToBufferChunk(expectedOutputs),
+            sink.call<Pothos::BufferChunk>("getBuffer"));
+    }
+
+    // Each value of input 1 applies to broadcastSize values of input 0.
+    template <typename T, typename BinaryOp>
+    void testBroadcastTwoToOneBlock(
+        const Pothos::Proxy& testBlock,
+        size_t broadcastSize,
+        BinaryOp binaryOp)
+    {
+        static const Pothos::DType dtype(typeid(T));
+
+        std::cout << " * Testing broadcast size " << broadcastSize << "..." << std::endl;
+
+        testBlock.call("setBroadcastSize", broadcastSize);
+        POTHOS_TEST_EQUAL(broadcastSize, testBlock.call<size_t>("broadcastSize"));
+
+        // The last frame is deliberately partial.
+        constexpr size_t numInputs = 1000;
+        const size_t numValues = (numInputs + broadcastSize - 1) / broadcastSize;
+
+        std::vector<T> inputs0;
+        for(size_t i = 0; i < numInputs; ++i) inputs0.emplace_back(T(float(i % 11) - 5.0f));
+
+        std::vector<T> inputs1;
+        for(size_t i = 0; i < numValues; ++i) inputs1.emplace_back(T(float(i % 5) + 0.5f));
+
+        std::vector<T> expectedOutputs;
+        for(size_t i = 0; i < numInputs; ++i)
+        {
+            expectedOutputs.emplace_back(binaryOp(inputs0[i], inputs1[i / broadcastSize]));
+        }
+
+        auto source0 = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+        source0.call("feedBuffer", stdVectorToBufferChunk(inputs0));
+
+        auto source1 = Pothos::BlockRegistry::make("/blocks/feeder_source", dtype);
+        source1.call("feedBuffer", stdVectorToBufferChunk(inputs1));
+
+        auto sink = Pothos::BlockRegistry::make("/blocks/collector_sink", dtype);
+
+        {
+            Pothos::Topology topology;
+            topology.connect(source0, 0, testBlock, 0);
+            topology.connect(source1, 0, testBlock, 1);
+            topology.connect(testBlock, 0, sink, 0);
+
+            topology.commit();
+            POTHOS_TEST_TRUE(topology.waitInactive(0.01));
+        }
+
+        testBufferChunks<T>(
+            stdVectorToBufferChunk(expectedOutputs),
+            sink.call<Pothos::BufferChunk>("getBuffer"));
+    }
+
     // Note: only use if input types are same and output types are same
     template <typename InType, typename OutType>
     void testMToNBlock(
@@ -0,0 +1,255 @@
+// Copyright 2021,2023 Nicholas Corgan
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+// Runs this module's benchmark plugin calls and writes their reports
+// as JSON.
+
+#include <Pothos/Callable.hpp>
+#include <Pothos/Exception.hpp>
+#include <Pothos/Init.hpp>
+#include <Pothos/Object/Containers.hpp>
+#include <Pothos/Plugin.hpp>
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//
+// JSON output
+//
+
+static std::string jsonString(const std::string& str)
+{
+    std::ostringstream stream;
+    stream << '"';
+    for(const char c: str)
+    {
+        if((c == '"') || (c == '\\')) stream << '\\' << c;
+        else if(static_cast<unsigned char>(c) < 0x20)
+        {
+            stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c) << std::dec;
+        }
+        else stream << c;
+    }
+    stream << '"';
+
+    return stream.str();
+}
+
+static void writeJSON(
+    std::ostream& stream,
+    const Pothos::Object& object,
+    size_t depth)
+{
+    const std::string indent((depth + 1) * 2, ' ');
+    const std::string closingIndent(depth * 2, ' ');
+
+    if(object.type() == typeid(Pothos::ObjectKwargs))
+    {
+        const auto& kwargs = object.extract<Pothos::ObjectKwargs>();
+
+        stream << "{";
+        for(auto iter = kwargs.begin(); iter != kwargs.end(); ++iter)
+        {
+            stream << ((iter == kwargs.begin()) ? "\n" : ",\n") << indent << jsonString(iter->first) << ": ";
+            writeJSON(stream, iter->second, depth + 1);
+        }
+        stream << "\n" << closingIndent << "}";
+    }
+    else if(object.type() == typeid(Pothos::ObjectVector))
+    {
+        const auto& vector = object.extract<Pothos::ObjectVector>();
+
+        stream << "[";
+        for(size_t i = 0; i < vector.size(); ++i)
+        {
+            stream << ((0 == i) ? "\n" : ",\n") << indent;
+            writeJSON(stream, vector[i], depth + 1);
+        }
+        stream << "\n" << closingIndent << "]";
+    }
+    else if(object.type() == typeid(std::vector<size_t>))
+    {
+        const auto& vector = object.extract<std::vector<size_t>>();
+
+        stream << "[";
+        for(size_t i = 0; i < vector.size(); ++i) stream << ((0 == i) ? "" : ", ") << vector[i];
+        stream << "]";
+    }
+    else if(object.type() == typeid(std::vector<std::string>))
+    {
+        const auto& vector = object.extract<std::vector<std::string>>();
+
+        stream << "[";
+        for(size_t i = 0; i < vector.size(); ++i) stream << ((0 == i) ? "" : ", ") << jsonString(vector[i]);
+        stream << "]";
+    }
+    else if(object.type() == typeid(std::string)) stream << jsonString(object.extract<std::string>());
+    else if(object.type() == typeid(bool)) stream << (object.extract<bool>() ? "true" : "false");
+    else stream << std::setprecision(9) << object.convert<double>();
+}
+
+//
+// Modes
+//
+
+static const std::string DefaultScalingDType = "complex_int16";
+static const std::string DefaultScalingChain =
+    "/volk/convert(complex_int16,complex_float32) "
+    "/volk/multiply_conjugate(complex_float32,complex_float32) "
+    "/volk/magnitude_squared "
+    "/volk/log2";
+
+static void printUsage()
+{
+    std::cerr << "Usage: PothosVOLKBench characterize|scaling [options]\n"
+              << "\n"
+              << "characterize: Measures the ULP error and throughput of each\n"
+              << "implementation of the VOLK kernels this module uses.\n"
+              << "\n"
+              << "  --kernels REGEX    Only kernels whose names match (default: all)\n"
+              << "  --points N         Inputs swept for error (default: 1048576)\n"
+              << "  --sizes N,N,...    Sizes timed for throughput (default: 64,4096,262144)\n"
+              << "  --min-time SEC     Minimum time for each throughput size (default: 0.1)\n"
+              << "\n"
+              << "scaling: Measures the throughput of 1 to N independent copies of a\n"
+              << "chain of blocks, with and without VOLK's buffer allocator.\n"
+              << "\n"
+              << "  --dtype DTYPE      The chain's input type (default: " << DefaultScalingDType << ")\n"
+              << "  --chain BLOCKS     Space-separated blocks, as path(arg,...) (default:\n"
+              << "                     \"" << DefaultScalingChain << "\")\n"
+              << "  --max-chains N     The most copies to run (default: number of CPUs)\n"
+              << "  --seconds SEC      Time measured for each number of copies (default: 1.0)\n"
+              << "\n"
+              << "Both modes:\n"
+              << "  --output FILE      Write the report here instead of stdout\n";
+}
+
+static std::vector<size_t> parseSizes(const std::string& str)
+{
+    std::vector<size_t> sizes;
+
+    std::istringstream stream(str);
+    std::string size;
+    while(std::getline(stream, size, ',')) sizes.emplace_back(std::stoul(size));
+
+    return sizes;
+}
+
+static Pothos::Callable getPluginCall(const std::string& path)
+{
+    return Pothos::PluginRegistry::get(path).getObject().extract<Pothos::Callable>();
+}
+
+using Options = std::map<std::string, std::string>;
+
+static const std::map<std::string, std::set<std::string>> ModeOptionNames =
+{
+    {"characterize", {"--kernels", "--points", "--sizes", "--min-time", "--output"}},
+    {"scaling", {"--dtype", "--chain", "--max-chains", "--seconds", "--output"}},
+};
+
+static std::string getOption(
+    const Options& options,
+    const std::string& name,
+    const std::string& defaultValue)
+{
+    const auto iter = options.find(name);
+    return (iter != options.end()) ? iter->second : defaultValue;
+}
+
+static Pothos::Object characterize(const Options& options)
+{
+    const auto report = getPluginCall("/volk/characterize").call<Pothos::ObjectKwargs>(
+        getOption(options, "--kernels", ""),
+        size_t(std::stoul(getOption(options, "--points", "1048576"))),
+        parseSizes(getOption(options, "--sizes", "64,4096,262144")),
+        std::stod(getOption(options, "--min-time", "0.1")));
+
+    return Pothos::Object(report);
+}
+
+static Pothos::Object benchmarkScaling(const Options& options)
+{
+    std::vector<std::string> blockSpecs;
+
+    std::istringstream chainStream(getOption(options, "--chain", DefaultScalingChain));
+    std::string blockSpec;
+    while(chainStream >> blockSpec) blockSpecs.emplace_back(blockSpec);
+
+    const auto report = getPluginCall("/volk/benchmark_scaling").call<Pothos::ObjectKwargs>(
+        getOption(options, "--dtype", DefaultScalingDType),
+        blockSpecs,
+        size_t(std::stoul(getOption(options, "--max-chains", "0"))),
+        std::stod(getOption(options, "--seconds", "1.0")));
+
+    return Pothos::Object(report);
+}
+
+int main(int argc, char** argv)
+{
+    if((argc < 2) || ((argc % 2) != 0))
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    const std::string mode(argv[1]);
+    const auto modeIter = ModeOptionNames.find(mode);
+    if(modeIter == ModeOptionNames.end())
+    {
+        printUsage();
+        return EXIT_FAILURE;
+    }
+
+    Options options;
+    for(int i = 2; i < argc; i += 2)
+    {
+        if(0 == modeIter->second.count(argv[i]))
+        {
+            std::cerr << "Unknown " << mode << " option: " << argv[i] << "\n\n";
+            printUsage();
+            return EXIT_FAILURE;
+        }
+
+        options[argv[i]] = argv[i+1];
+    }
+
+    try
+    {
+        Pothos::ScopedInit init;
+
+        const auto report = (mode == "characterize") ? characterize(options) : benchmarkScaling(options);
+
+        const auto outputIter = options.find("--output");
+        if(outputIter != options.end())
+        {
+            std::ofstream file(outputIter->second);
+            writeJSON(file, report, 0);
+            file << std::endl;
+        }
+        else
+        {
+            writeJSON(std::cout, report, 0);
+            std::cout << std::endl;
+        }
+    }
+    catch(const Pothos::Exception& ex)
+    {
+        std::cerr << ex.displayText() << std::endl;
+        return EXIT_FAILURE;
+    }
+    catch(const std::exception& ex)
+    {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}